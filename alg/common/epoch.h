@@ -0,0 +1,212 @@
+#ifndef ALG_MEMORY_EPOCH_H_
+#define ALG_MEMORY_EPOCH_H_
+
+#include <cstddef>
+#include <cstdint>
+
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <thread>
+
+#include "alg/data_structure/extendable_array.h"
+
+namespace alg {
+namespace memory {
+
+class EpochDomain {
+public:
+    class Guard {
+    public:
+        Guard(const Guard&) = delete;
+        Guard& operator=(const Guard&) = delete;
+
+        Guard(Guard&& rhs) noexcept;
+        ~Guard();
+
+        void retire(void* p, void (*deleter)(void*));
+
+    private:
+        EpochDomain* domain;
+        std::size_t slot;
+
+        Guard(EpochDomain* domain, std::size_t slot);
+
+        friend class EpochDomain;
+    };
+
+    explicit EpochDomain(std::size_t slots = 128);
+
+    EpochDomain(const EpochDomain&) = delete;
+    EpochDomain& operator=(const EpochDomain&) = delete;
+
+    ~EpochDomain();
+
+    Guard pin();
+
+    std::uint64_t epoch() const;
+    std::size_t pending() const;
+
+private:
+    static constexpr std::size_t cache_line = 64;
+    static constexpr std::size_t buckets = 3;
+    static constexpr std::size_t collect_threshold = 64;
+
+    class Retired {
+    public:
+        void* p;
+        void (*deleter)(void*);
+    };
+
+    class Slot {
+    public:
+        std::atomic<std::uint64_t> state{0};
+
+        ds::ExtendableArray<Retired> retired[buckets];
+        std::uint64_t tag[buckets] = {};
+        std::size_t pending{0};
+
+        char padding[cache_line];
+    };
+
+    std::atomic<std::uint64_t> epoch_{0};
+    char padding[cache_line];
+
+    std::size_t slots_;
+    std::unique_ptr<Slot[]> slot;
+
+    bool try_advance(std::uint64_t epoch);
+
+    void reclaim(Slot& s, std::uint64_t epoch);
+    static void free_bucket(Slot& s, std::size_t bucket);
+
+    static std::size_t hint();
+};
+
+inline EpochDomain::Guard::Guard(EpochDomain* domain, std::size_t slot) :
+        domain{domain}, slot{slot} {
+}
+
+inline EpochDomain::Guard::Guard(Guard&& rhs) noexcept :
+        domain{rhs.domain}, slot{rhs.slot} {
+
+    rhs.domain = nullptr;
+}
+
+inline EpochDomain::Guard::~Guard() {
+    if (domain) {
+        domain->slot[slot].state.store(0, std::memory_order_release);
+    }
+}
+
+inline void EpochDomain::Guard::retire(void* p, void (*deleter)(void*)) {
+    Slot& s = domain->slot[slot];
+    std::uint64_t epoch = domain->epoch_.load(std::memory_order_seq_cst);
+    std::size_t bucket = epoch % buckets;
+
+    if (s.tag[bucket] != epoch) {
+        free_bucket(s, bucket);
+        s.tag[bucket] = epoch;
+    }
+
+    s.retired[bucket].append(Retired{p, deleter});
+
+    if (++s.pending >= collect_threshold) {
+        domain->try_advance(epoch);
+        domain->reclaim(s, domain->epoch_.load(std::memory_order_seq_cst));
+    }
+}
+
+inline EpochDomain::EpochDomain(std::size_t slots) :
+        slots_{std::max<std::size_t>(slots, 1)}, slot{new Slot[slots_]} {
+}
+
+inline EpochDomain::~EpochDomain() {
+    for (std::size_t i = 0; i < slots_; ++i) {
+        for (std::size_t b = 0; b < buckets; ++b) {
+            free_bucket(slot[i], b);
+        }
+    }
+}
+
+inline EpochDomain::Guard EpochDomain::pin() {
+    std::size_t i = hint() % slots_;
+
+    while (true) {
+        for (std::size_t n = 0; n < slots_; ++n) {
+            std::uint64_t epoch = epoch_.load(std::memory_order_seq_cst);
+            std::uint64_t expected = 0;
+
+            if (slot[i].state.compare_exchange_strong(expected,
+                    (epoch << 1) | 1, std::memory_order_seq_cst)) {
+
+                reclaim(slot[i], epoch);
+
+                return Guard(this, i);
+            }
+
+            i = (i + 1) % slots_;
+        }
+
+        std::this_thread::yield();
+    }
+}
+
+inline std::uint64_t EpochDomain::epoch() const {
+    return epoch_.load(std::memory_order_relaxed);
+}
+
+inline std::size_t EpochDomain::pending() const {
+    std::size_t n = 0;
+
+    for (std::size_t i = 0; i < slots_; ++i) {
+        n += slot[i].pending;
+    }
+
+    return n;
+}
+
+inline bool EpochDomain::try_advance(std::uint64_t epoch) {
+    for (std::size_t i = 0; i < slots_; ++i) {
+        std::uint64_t state = slot[i].state.load(std::memory_order_seq_cst);
+
+        if ((state & 1) && (state >> 1) != epoch) {
+            return false;
+        }
+    }
+
+    return epoch_.compare_exchange_strong(epoch, epoch + 1,
+            std::memory_order_seq_cst);
+}
+
+inline void EpochDomain::reclaim(Slot& s, std::uint64_t epoch) {
+    for (std::size_t b = 0; b < buckets; ++b) {
+        if (s.retired[b].count() && s.tag[b] + 2 <= epoch) {
+            free_bucket(s, b);
+        }
+    }
+}
+
+inline void EpochDomain::free_bucket(Slot& s, std::size_t bucket) {
+    ds::ExtendableArray<Retired>& retired = s.retired[bucket];
+
+    for (std::size_t i = 0; i < retired.count(); ++i) {
+        retired[i].deleter(retired[i].p);
+    }
+
+    s.pending -= retired.count();
+    retired.clear();
+}
+
+inline std::size_t EpochDomain::hint() {
+    static thread_local std::size_t h =
+            std::hash<std::thread::id>()(std::this_thread::get_id());
+
+    return h;
+}
+
+}
+}
+
+#endif
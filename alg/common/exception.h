@@ -21,6 +21,11 @@ public:
     ItemNotFound() : std::invalid_argument("Item not found") {}
 };
 
+class ItemExists : public std::invalid_argument {
+public:
+    ItemExists() : std::invalid_argument("Item already exists") {}
+};
+
 }
 }
 
@@ -0,0 +1,217 @@
+#ifndef ALG_MEMORY_NODE_POOL_H_
+#define ALG_MEMORY_NODE_POOL_H_
+
+#include <cstddef>
+
+#include <algorithm>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace alg {
+namespace memory {
+
+template <class T>
+class NodePool {
+public:
+    using value_type = T;
+
+    explicit NodePool(std::size_t chunk_size = 32);
+
+    NodePool(const NodePool<T>&) = delete;
+    NodePool<T>& operator=(const NodePool<T>&) = delete;
+
+    ~NodePool();
+
+    template <class... Args>
+    T* create(Args&&... args);
+    void destroy(T* p);
+
+    T* allocate();
+    void deallocate(T* p);
+
+    void splice(NodePool<T>& rhs);
+    void release();
+
+    std::size_t count() const;
+    std::size_t capacity() const;
+
+private:
+    union Slot {
+        Slot* next;
+        std::size_t size;
+        typename std::aligned_storage<sizeof(T), alignof(T)>::type storage;
+    };
+
+    static constexpr std::size_t header_size = 2;
+    static constexpr std::size_t max_chunk_size = 4096;
+
+    std::allocator<Slot> alloc;
+
+    Slot* chunks{nullptr};
+    Slot* last_chunk{nullptr};
+
+    Slot* free_list{nullptr};
+    Slot* free_tail{nullptr};
+
+    std::size_t chunk_size;
+    std::size_t count_{0};
+    std::size_t capacity_{0};
+
+    void grow();
+};
+
+template <class T>
+constexpr std::size_t NodePool<T>::header_size;
+
+template <class T>
+constexpr std::size_t NodePool<T>::max_chunk_size;
+
+template <class T>
+NodePool<T>::NodePool(std::size_t chunk_size) :
+        chunk_size{std::max<std::size_t>(chunk_size, 1)} {
+}
+
+template <class T>
+NodePool<T>::~NodePool() {
+    release();
+}
+
+template <class T>
+template <class... Args>
+T* NodePool<T>::create(Args&&... args) {
+    T* p = allocate();
+
+    try {
+        ::new (static_cast<void*>(p)) T(std::forward<Args>(args)...);
+    } catch (...) {
+        deallocate(p);
+        throw;
+    }
+
+    return p;
+}
+
+template <class T>
+void NodePool<T>::destroy(T* p) {
+    p->~T();
+    deallocate(p);
+}
+
+template <class T>
+T* NodePool<T>::allocate() {
+    if (!free_list) {
+        grow();
+    }
+
+    Slot* slot = free_list;
+    free_list = slot->next;
+
+    if (!free_list) {
+        free_tail = nullptr;
+    }
+
+    ++count_;
+
+    return reinterpret_cast<T*>(&slot->storage);
+}
+
+template <class T>
+void NodePool<T>::deallocate(T* p) {
+    Slot* slot = reinterpret_cast<Slot*>(p);
+
+    slot->next = free_list;
+    free_list = slot;
+
+    if (!free_tail) {
+        free_tail = slot;
+    }
+
+    --count_;
+}
+
+template <class T>
+void NodePool<T>::splice(NodePool<T>& rhs) {
+    if (this == &rhs || !rhs.chunks) {
+        return;
+    }
+
+    if (last_chunk) {
+        last_chunk->next = rhs.chunks;
+    } else {
+        chunks = rhs.chunks;
+    }
+    last_chunk = rhs.last_chunk;
+
+    if (rhs.free_list) {
+        if (free_tail) {
+            free_tail->next = rhs.free_list;
+        } else {
+            free_list = rhs.free_list;
+        }
+        free_tail = rhs.free_tail;
+    }
+
+    count_ += rhs.count_;
+    capacity_ += rhs.capacity_;
+    chunk_size = std::max(chunk_size, rhs.chunk_size);
+
+    rhs.chunks = rhs.last_chunk = nullptr;
+    rhs.free_list = rhs.free_tail = nullptr;
+    rhs.count_ = rhs.capacity_ = 0;
+}
+
+template <class T>
+void NodePool<T>::release() {
+    while (chunks) {
+        Slot* next = chunks[0].next;
+        alloc.deallocate(chunks, chunks[1].size);
+        chunks = next;
+    }
+
+    last_chunk = nullptr;
+    free_list = free_tail = nullptr;
+    count_ = capacity_ = 0;
+}
+
+template <class T>
+std::size_t NodePool<T>::count() const {
+    return count_;
+}
+
+template <class T>
+std::size_t NodePool<T>::capacity() const {
+    return capacity_;
+}
+
+template <class T>
+void NodePool<T>::grow() {
+    std::size_t size = chunk_size + header_size;
+    Slot* chunk = alloc.allocate(size);
+
+    chunk[0].next = nullptr;
+    chunk[1].size = size;
+
+    if (last_chunk) {
+        last_chunk->next = chunk;
+    } else {
+        chunks = chunk;
+    }
+    last_chunk = chunk;
+
+    for (std::size_t i = header_size; i + 1 < size; ++i) {
+        chunk[i].next = &chunk[i + 1];
+    }
+    chunk[size - 1].next = nullptr;
+
+    free_list = &chunk[header_size];
+    free_tail = &chunk[size - 1];
+
+    capacity_ += chunk_size;
+    chunk_size = std::min(chunk_size * 2, max_chunk_size);
+}
+
+}
+}
+
+#endif
@@ -0,0 +1,270 @@
+#ifndef ALG_DS_BLOCKING_QUEUE_H_
+#define ALG_DS_BLOCKING_QUEUE_H_
+
+#include <cstddef>
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <stdexcept>
+#include <utility>
+
+#include "alg/data_structure/queue.h"
+
+namespace alg {
+namespace ds {
+
+template <class T>
+class BlockingQueue {
+public:
+    explicit BlockingQueue(std::size_t n);
+
+    BlockingQueue(const BlockingQueue<T>&) = delete;
+    BlockingQueue<T>& operator=(const BlockingQueue<T>&) = delete;
+
+    bool enqueue(const T& element);
+    bool enqueue(T&& element);
+
+    template <class Rep, class Period>
+    bool try_enqueue_for(const T& element,
+            const std::chrono::duration<Rep, Period>& timeout);
+
+    template <class Rep, class Period>
+    bool try_enqueue_for(T&& element,
+            const std::chrono::duration<Rep, Period>& timeout);
+
+    bool dequeue(T& element);
+
+    template <class Rep, class Period>
+    bool try_dequeue_for(T& element,
+            const std::chrono::duration<Rep, Period>& timeout);
+
+    template <class OutputIt>
+    std::size_t drain(OutputIt out, std::size_t n);
+
+    void close();
+    bool is_closed() const;
+
+    std::size_t count() const;
+    std::size_t capacity() const;
+
+private:
+    mutable std::mutex lock;
+    std::condition_variable not_empty;
+    std::condition_variable not_full;
+
+    Queue<T> queue;
+    std::size_t capacity_;
+
+    std::size_t waiting_producers{0};
+    std::size_t waiting_consumers{0};
+    bool closed{false};
+
+    template <class U, class Wait>
+    bool push(U&& element, Wait wait);
+
+    template <class Wait>
+    bool pop(T& element, Wait wait);
+};
+
+template <class T>
+BlockingQueue<T>::BlockingQueue(std::size_t n) : queue(n), capacity_{n} {
+    if (!n) {
+        throw std::invalid_argument("Capacity must be positive");
+    }
+}
+
+template <class T>
+bool BlockingQueue<T>::enqueue(const T& element) {
+    return push(element, [this](std::unique_lock<std::mutex>& guard) {
+        not_full.wait(guard);
+        return true;
+    });
+}
+
+template <class T>
+bool BlockingQueue<T>::enqueue(T&& element) {
+    return push(std::move(element),
+            [this](std::unique_lock<std::mutex>& guard) {
+                not_full.wait(guard);
+                return true;
+            });
+}
+
+template <class T>
+template <class Rep, class Period>
+bool BlockingQueue<T>::try_enqueue_for(const T& element,
+        const std::chrono::duration<Rep, Period>& timeout) {
+
+    auto deadline = std::chrono::steady_clock::now() + timeout;
+
+    return push(element, [this, deadline](std::unique_lock<std::mutex>& guard) {
+        return not_full.wait_until(guard, deadline) ==
+                std::cv_status::no_timeout;
+    });
+}
+
+template <class T>
+template <class Rep, class Period>
+bool BlockingQueue<T>::try_enqueue_for(T&& element,
+        const std::chrono::duration<Rep, Period>& timeout) {
+
+    auto deadline = std::chrono::steady_clock::now() + timeout;
+
+    return push(std::move(element),
+            [this, deadline](std::unique_lock<std::mutex>& guard) {
+                return not_full.wait_until(guard, deadline) ==
+                        std::cv_status::no_timeout;
+            });
+}
+
+template <class T>
+bool BlockingQueue<T>::dequeue(T& element) {
+    return pop(element, [this](std::unique_lock<std::mutex>& guard) {
+        not_empty.wait(guard);
+        return true;
+    });
+}
+
+template <class T>
+template <class Rep, class Period>
+bool BlockingQueue<T>::try_dequeue_for(T& element,
+        const std::chrono::duration<Rep, Period>& timeout) {
+
+    auto deadline = std::chrono::steady_clock::now() + timeout;
+
+    return pop(element, [this, deadline](std::unique_lock<std::mutex>& guard) {
+        return not_empty.wait_until(guard, deadline) ==
+                std::cv_status::no_timeout;
+    });
+}
+
+template <class T>
+template <class OutputIt>
+std::size_t BlockingQueue<T>::drain(OutputIt out, std::size_t n) {
+    if (!n) {
+        return 0;
+    }
+
+    std::unique_lock<std::mutex> guard(lock);
+
+    while (!queue.count() && !closed) {
+        ++waiting_consumers;
+        not_empty.wait(guard);
+        --waiting_consumers;
+    }
+
+    std::size_t taken = 0;
+
+    for ( ; taken < n && queue.count(); ++taken) {
+        *out++ = queue.dequeue();
+    }
+
+    std::size_t producers = waiting_producers;
+    guard.unlock();
+
+    if (producers && taken > 1) {
+        not_full.notify_all();
+    } else if (producers && taken) {
+        not_full.notify_one();
+    }
+
+    return taken;
+}
+
+template <class T>
+void BlockingQueue<T>::close() {
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        closed = true;
+    }
+
+    not_empty.notify_all();
+    not_full.notify_all();
+}
+
+template <class T>
+bool BlockingQueue<T>::is_closed() const {
+    std::lock_guard<std::mutex> guard(lock);
+
+    return closed;
+}
+
+template <class T>
+std::size_t BlockingQueue<T>::count() const {
+    std::lock_guard<std::mutex> guard(lock);
+
+    return queue.count();
+}
+
+template <class T>
+std::size_t BlockingQueue<T>::capacity() const {
+    return capacity_;
+}
+
+template <class T>
+template <class U, class Wait>
+bool BlockingQueue<T>::push(U&& element, Wait wait) {
+    std::unique_lock<std::mutex> guard(lock);
+
+    while (!closed && queue.count() == capacity_) {
+        ++waiting_producers;
+        bool woken = wait(guard);
+        --waiting_producers;
+
+        if (!woken && !closed && queue.count() == capacity_) {
+            return false;
+        }
+    }
+
+    if (closed) {
+        return false;
+    }
+
+    queue.enqueue(std::forward<U>(element));
+
+    bool notify = waiting_consumers > 0;
+    guard.unlock();
+
+    if (notify) {
+        not_empty.notify_one();
+    }
+
+    return true;
+}
+
+template <class T>
+template <class Wait>
+bool BlockingQueue<T>::pop(T& element, Wait wait) {
+    std::unique_lock<std::mutex> guard(lock);
+
+    while (!queue.count() && !closed) {
+        ++waiting_consumers;
+        bool woken = wait(guard);
+        --waiting_consumers;
+
+        if (!woken && !queue.count()) {
+            return false;
+        }
+    }
+
+    if (!queue.count()) {
+        return false;
+    }
+
+    element = queue.dequeue();
+
+    bool notify = waiting_producers > 0;
+    guard.unlock();
+
+    if (notify) {
+        not_full.notify_one();
+    }
+
+    return true;
+}
+
+}
+}
+
+#endif
@@ -0,0 +1,436 @@
+#ifndef ALG_DS_CONCURRENT_SKIP_LIST_MAP_H_
+#define ALG_DS_CONCURRENT_SKIP_LIST_MAP_H_
+
+#include <cstddef>
+#include <cstdint>
+
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <new>
+#include <random>
+#include <type_traits>
+#include <utility>
+
+#include "alg/common/epoch.h"
+
+namespace alg {
+namespace ds {
+
+template <class K, class V, class Compare = std::less<K>>
+class ConcurrentSkipListMap {
+public:
+    static constexpr std::size_t max_level = 16;
+
+    explicit ConcurrentSkipListMap(const Compare& comp = Compare());
+
+    ConcurrentSkipListMap(const ConcurrentSkipListMap<K, V, Compare>&) = delete;
+    ConcurrentSkipListMap<K, V, Compare>& operator=(
+            const ConcurrentSkipListMap<K, V, Compare>&) = delete;
+
+    ~ConcurrentSkipListMap();
+
+    bool insert(const K& key, const V& value);
+    bool erase(const K& key);
+
+    bool contains(const K& key) const;
+    bool find(const K& key, V& value) const;
+
+    template <class F>
+    void for_each(F f) const;
+
+    std::size_t count() const;
+
+private:
+    using entry_type = std::pair<K, V>;
+    using allocator_type = std::allocator<entry_type>;
+    using link_type = std::atomic<std::uintptr_t>;
+
+    class Node {
+    public:
+        typename std::aligned_storage<sizeof(entry_type),
+                alignof(entry_type)>::type storage;
+        std::atomic<int> owners;
+        std::size_t height;
+        link_type next[1];
+
+        entry_type& entry() {
+            return *reinterpret_cast<entry_type*>(&storage);
+        }
+
+        const K& key() {
+            return entry().first;
+        }
+    };
+
+    static_assert(alignof(Node) <= alignof(std::max_align_t),
+            "ConcurrentSkipListMap nodes are only max_align_t aligned");
+
+    Compare comp;
+    mutable memory::EpochDomain domain;
+
+    Node* head;
+    std::atomic<std::size_t> count_{0};
+
+    static Node* allocate(std::size_t height);
+    static void deallocate(void* p);
+
+    static Node* pointer(std::uintptr_t link);
+    static bool marked(std::uintptr_t link);
+
+    static std::size_t random_height();
+
+    bool locate(const K& key, Node** preds, Node** succs);
+    Node* search(const K& key) const;
+    void release(memory::EpochDomain::Guard& guard, Node* node);
+};
+
+template <class K, class V, class Compare>
+constexpr std::size_t ConcurrentSkipListMap<K, V, Compare>::max_level;
+
+template <class K, class V, class Compare>
+ConcurrentSkipListMap<K, V, Compare>::ConcurrentSkipListMap(
+        const Compare& comp) : comp(comp), head{allocate(max_level)} {
+}
+
+template <class K, class V, class Compare>
+ConcurrentSkipListMap<K, V, Compare>::~ConcurrentSkipListMap() {
+    Node* x = pointer(head->next[0].load(std::memory_order_relaxed));
+
+    while (x) {
+        Node* next = pointer(x->next[0].load(std::memory_order_relaxed));
+
+        allocator_type alloc;
+        std::allocator_traits<allocator_type>::destroy(alloc, &x->entry());
+        deallocate(x);
+
+        x = next;
+    }
+
+    deallocate(head);
+}
+
+template <class K, class V, class Compare>
+bool ConcurrentSkipListMap<K, V, Compare>::insert(const K& key,
+        const V& value) {
+
+    memory::EpochDomain::Guard guard = domain.pin();
+
+    Node* preds[max_level];
+    Node* succs[max_level];
+    Node* node = nullptr;
+    std::size_t height = random_height();
+
+    while (true) {
+        if (locate(key, preds, succs)) {
+            if (node) {
+                allocator_type alloc;
+                std::allocator_traits<allocator_type>::destroy(alloc,
+                        &node->entry());
+                deallocate(node);
+            }
+
+            return false;
+        }
+
+        if (!node) {
+            node = allocate(height);
+
+            try {
+                allocator_type alloc;
+                std::allocator_traits<allocator_type>::construct(alloc,
+                        &node->entry(), key, value);
+            } catch (...) {
+                deallocate(node);
+                throw;
+            }
+
+            node->owners.store(2, std::memory_order_relaxed);
+        }
+
+        for (std::size_t i = 0; i < height; ++i) {
+            node->next[i].store(reinterpret_cast<std::uintptr_t>(succs[i]),
+                    std::memory_order_relaxed);
+        }
+
+        std::uintptr_t expected = reinterpret_cast<std::uintptr_t>(succs[0]);
+
+        if (preds[0]->next[0].compare_exchange_strong(expected,
+                reinterpret_cast<std::uintptr_t>(node),
+                std::memory_order_acq_rel)) {
+            break;
+        }
+    }
+
+    count_.fetch_add(1, std::memory_order_relaxed);
+
+    for (std::size_t level = 1; level < height; ) {
+        std::uintptr_t link = node->next[level].load(std::memory_order_acquire);
+        std::uintptr_t succ = reinterpret_cast<std::uintptr_t>(succs[level]);
+
+        if (marked(link)) {
+            break;
+        }
+
+        if (link != succ && !node->next[level].compare_exchange_strong(
+                link, succ, std::memory_order_acq_rel)) {
+            continue;
+        }
+
+        std::uintptr_t expected = succ;
+
+        if (preds[level]->next[level].compare_exchange_strong(expected,
+                reinterpret_cast<std::uintptr_t>(node),
+                std::memory_order_acq_rel)) {
+            ++level;
+        } else {
+            locate(key, preds, succs);
+        }
+    }
+
+    if (marked(node->next[0].load(std::memory_order_acquire))) {
+        locate(key, preds, succs);
+    }
+
+    release(guard, node);
+
+    return true;
+}
+
+template <class K, class V, class Compare>
+bool ConcurrentSkipListMap<K, V, Compare>::erase(const K& key) {
+    memory::EpochDomain::Guard guard = domain.pin();
+
+    Node* preds[max_level];
+    Node* succs[max_level];
+
+    if (!locate(key, preds, succs)) {
+        return false;
+    }
+
+    Node* node = succs[0];
+
+    for (std::size_t level = node->height; level-- > 1; ) {
+        std::uintptr_t link = node->next[level].load(std::memory_order_acquire);
+
+        while (!marked(link) && !node->next[level].compare_exchange_weak(
+                link, link | 1, std::memory_order_acq_rel)) {
+        }
+    }
+
+    std::uintptr_t link = node->next[0].load(std::memory_order_acquire);
+
+    while (!marked(link)) {
+        if (node->next[0].compare_exchange_weak(link, link | 1,
+                std::memory_order_acq_rel)) {
+
+            locate(key, preds, succs);
+            count_.fetch_sub(1, std::memory_order_relaxed);
+            release(guard, node);
+
+            return true;
+        }
+    }
+
+    return false;
+}
+
+template <class K, class V, class Compare>
+bool ConcurrentSkipListMap<K, V, Compare>::contains(const K& key) const {
+    memory::EpochDomain::Guard guard = domain.pin();
+
+    return search(key) != nullptr;
+}
+
+template <class K, class V, class Compare>
+bool ConcurrentSkipListMap<K, V, Compare>::find(const K& key, V& value) const {
+    memory::EpochDomain::Guard guard = domain.pin();
+    Node* node = search(key);
+
+    if (!node) {
+        return false;
+    }
+
+    value = node->entry().second;
+
+    return true;
+}
+
+template <class K, class V, class Compare>
+template <class F>
+void ConcurrentSkipListMap<K, V, Compare>::for_each(F f) const {
+    memory::EpochDomain::Guard guard = domain.pin();
+    Node* x = pointer(head->next[0].load(std::memory_order_acquire));
+
+    while (x) {
+        std::uintptr_t link = x->next[0].load(std::memory_order_acquire);
+
+        if (!marked(link)) {
+            const entry_type& entry = x->entry();
+            f(entry.first, entry.second);
+        }
+
+        x = pointer(link);
+    }
+}
+
+template <class K, class V, class Compare>
+std::size_t ConcurrentSkipListMap<K, V, Compare>::count() const {
+    return count_.load(std::memory_order_relaxed);
+}
+
+template <class K, class V, class Compare>
+typename ConcurrentSkipListMap<K, V, Compare>::Node*
+ConcurrentSkipListMap<K, V, Compare>::allocate(std::size_t height) {
+    std::size_t size = sizeof(Node) + (height - 1) * sizeof(link_type);
+    Node* node = ::new (::operator new(size)) Node;
+
+    node->height = height;
+
+    for (std::size_t i = 0; i < height; ++i) {
+        ::new (static_cast<void*>(&node->next[i])) link_type(0);
+    }
+
+    return node;
+}
+
+template <class K, class V, class Compare>
+void ConcurrentSkipListMap<K, V, Compare>::deallocate(void* p) {
+    ::operator delete(p);
+}
+
+template <class K, class V, class Compare>
+typename ConcurrentSkipListMap<K, V, Compare>::Node*
+ConcurrentSkipListMap<K, V, Compare>::pointer(std::uintptr_t link) {
+    return reinterpret_cast<Node*>(link & ~std::uintptr_t{1});
+}
+
+template <class K, class V, class Compare>
+bool ConcurrentSkipListMap<K, V, Compare>::marked(std::uintptr_t link) {
+    return link & 1;
+}
+
+template <class K, class V, class Compare>
+std::size_t ConcurrentSkipListMap<K, V, Compare>::random_height() {
+    static thread_local std::uint64_t state = [] {
+        std::random_device rd;
+
+        return (std::uint64_t{rd()} << 32) | rd() | 1;
+    }();
+
+    state ^= state >> 12;
+    state ^= state << 25;
+    state ^= state >> 27;
+
+    std::uint64_t bits = (state * 0x2545F4914F6CDD1DULL) >> 32;
+    std::size_t height = 1;
+
+    while (height < max_level && !(bits & 3)) {
+        ++height;
+        bits >>= 2;
+    }
+
+    return height;
+}
+
+template <class K, class V, class Compare>
+bool ConcurrentSkipListMap<K, V, Compare>::locate(const K& key, Node** preds,
+        Node** succs) {
+
+retry:
+    Node* pred = head;
+    Node* curr = nullptr;
+
+    for (std::size_t level = max_level; level-- > 0; ) {
+        curr = pointer(pred->next[level].load(std::memory_order_acquire));
+
+        while (curr) {
+            std::uintptr_t succ = curr->next[level].load(
+                    std::memory_order_acquire);
+
+            while (marked(succ)) {
+                std::uintptr_t link = reinterpret_cast<std::uintptr_t>(curr);
+
+                if (!pred->next[level].compare_exchange_strong(link,
+                        succ & ~std::uintptr_t{1}, std::memory_order_acq_rel)) {
+                    goto retry;
+                }
+
+                curr = pointer(succ);
+
+                if (!curr) {
+                    break;
+                }
+
+                succ = curr->next[level].load(std::memory_order_acquire);
+            }
+
+            if (!curr || !comp(curr->key(), key)) {
+                break;
+            }
+
+            pred = curr;
+            curr = pointer(succ);
+        }
+
+        preds[level] = pred;
+        succs[level] = curr;
+    }
+
+    return curr && !comp(key, curr->key());
+}
+
+template <class K, class V, class Compare>
+typename ConcurrentSkipListMap<K, V, Compare>::Node*
+ConcurrentSkipListMap<K, V, Compare>::search(const K& key) const {
+    Node* pred = head;
+    Node* curr = nullptr;
+
+    for (std::size_t level = max_level; level-- > 0; ) {
+        curr = pointer(pred->next[level].load(std::memory_order_acquire));
+
+        while (curr) {
+            std::uintptr_t succ = curr->next[level].load(
+                    std::memory_order_acquire);
+
+            if (marked(succ)) {
+                curr = pointer(succ);
+                continue;
+            }
+
+            if (!comp(curr->key(), key)) {
+                break;
+            }
+
+            pred = curr;
+            curr = pointer(succ);
+        }
+    }
+
+    if (!curr || comp(key, curr->key()) ||
+            marked(curr->next[0].load(std::memory_order_acquire))) {
+        return nullptr;
+    }
+
+    return curr;
+}
+
+template <class K, class V, class Compare>
+void ConcurrentSkipListMap<K, V, Compare>::release(
+        memory::EpochDomain::Guard& guard, Node* node) {
+
+    if (node->owners.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        guard.retire(node, [](void* p) {
+            Node* x = static_cast<Node*>(p);
+            allocator_type alloc;
+
+            std::allocator_traits<allocator_type>::destroy(alloc, &x->entry());
+            deallocate(x);
+        });
+    }
+}
+
+}
+}
+
+#endif
@@ -3,8 +3,13 @@
 
 #include <cstddef>
 
+#include <algorithm>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+
 #include "alg/common/exception.h"
-#include "alg/data_structure/linked_list.h"
+#include "alg/data_structure/extendable_array.h"
 
 namespace alg {
 namespace ds {
@@ -12,8 +17,29 @@ namespace ds {
 template <class T>
 class Deque {
 public:
+    using allocator_type = std::allocator<T>;
+
+    static constexpr std::size_t block_size =
+            sizeof(T) < 256 ? 4096 / sizeof(T) : 16;
+
+    Deque();
+
+    Deque(const Deque<T>& rhs);
+    Deque(Deque<T>&& rhs) noexcept;
+
+    ~Deque();
+
     void push_back(const T& element);
+    void push_back(T&& element);
+
     void push_front(const T& element);
+    void push_front(T&& element);
+
+    template <class... Args>
+    void emplace_back(Args&&... args);
+
+    template <class... Args>
+    void emplace_front(Args&&... args);
 
     void pop_back();
     void pop_front();
@@ -26,73 +52,172 @@ public:
 
     std::size_t count() const;
 
+    void clear();
+    void shrink_to_fit();
+
+    T& operator[](std::size_t index);
+    const T& operator[](std::size_t index) const;
+
+    Deque<T>& operator=(const Deque<T>& rhs) &;
+    Deque<T>& operator=(Deque<T>&& rhs) & noexcept;
+
 private:
-    list::LinkedList<T> list;
+    allocator_type alloc;
+
+    T** map{nullptr};
+    std::size_t map_capacity{0};
+    std::size_t map_begin{0};
+    std::size_t map_end{0};
+
+    std::size_t start{0};
     std::size_t count_{0};
 
-    list::Node<T>* back_node();
-    const list::Node<T>* back_node() const;
+    ExtendableArray<T*> spare;
+
+    T* at(std::size_t index) const;
 
-    list::Node<T>* front_node();
-    const list::Node<T>* front_node() const;
+    T* acquire_block();
+    void release_blocks();
+    void remap();
+
+    void swap(Deque<T>& rhs) noexcept;
 };
 
+template <class T>
+constexpr std::size_t Deque<T>::block_size;
+
+template <class T>
+Deque<T>::Deque() {
+}
+
+template <class T>
+Deque<T>::Deque(const Deque<T>& rhs) : Deque() {
+    for (std::size_t i = 0; i < rhs.count_; ++i) {
+        push_back(*rhs.at(i));
+    }
+}
+
+template <class T>
+Deque<T>::Deque(Deque<T>&& rhs) noexcept : Deque() {
+    swap(rhs);
+}
+
+template <class T>
+Deque<T>::~Deque() {
+    clear();
+    shrink_to_fit();
+
+    delete[] map;
+}
+
 template <class T>
 void Deque<T>::push_back(const T& element) {
-    list.insert_last(element);
-    ++count_;
+    emplace_back(element);
+}
+
+template <class T>
+void Deque<T>::push_back(T&& element) {
+    emplace_back(std::move(element));
 }
 
 template <class T>
 void Deque<T>::push_front(const T& element) {
-    list.insert_first(element);
-    ++count_;
+    emplace_front(element);
 }
 
 template <class T>
-list::Node<T>* Deque<T>::back_node() {
-    return const_cast<list::Node<T>*>(
-            static_cast<const Deque<T>*>(this)->back_node());
+void Deque<T>::push_front(T&& element) {
+    emplace_front(std::move(element));
 }
 
 template <class T>
-const list::Node<T>* Deque<T>::back_node() const {
-    const list::Node<T>* node = list.last();
+template <class... Args>
+void Deque<T>::emplace_back(Args&&... args) {
+    std::size_t offset = start + count_;
+    std::size_t block = map_begin + offset / block_size;
 
-    if (!node) {
-        throw except::BufferEmpty();
+    if (block == map_end) {
+        if (map_end == map_capacity) {
+            remap();
+        }
+
+        map[map_end] = acquire_block();
+
+        try {
+            std::allocator_traits<allocator_type>::construct(alloc,
+                    &map[map_end][0], std::forward<Args>(args)...);
+        } catch (...) {
+            spare.append(map[map_end]);
+            throw;
+        }
+
+        ++map_end;
+    } else {
+        std::allocator_traits<allocator_type>::construct(alloc,
+                &map[block][offset % block_size], std::forward<Args>(args)...);
     }
 
-    return node;
+    ++count_;
 }
 
 template <class T>
-list::Node<T>* Deque<T>::front_node() {
-    return const_cast<list::Node<T>*>(
-            static_cast<const Deque<T>*>(this)->front_node());
-}
+template <class... Args>
+void Deque<T>::emplace_front(Args&&... args) {
+    if (!start) {
+        if (!map_begin) {
+            remap();
+        }
 
-template <class T>
-const list::Node<T>* Deque<T>::front_node() const {
-    const list::Node<T>* node = list.first();
+        map[map_begin - 1] = acquire_block();
 
-    if (!node) {
-        throw except::BufferEmpty();
+        try {
+            std::allocator_traits<allocator_type>::construct(alloc,
+                    &map[map_begin - 1][block_size - 1],
+                    std::forward<Args>(args)...);
+        } catch (...) {
+            spare.append(map[map_begin - 1]);
+            throw;
+        }
+
+        --map_begin;
+        start = block_size - 1;
+    } else {
+        std::allocator_traits<allocator_type>::construct(alloc,
+                &map[map_begin][start - 1], std::forward<Args>(args)...);
+
+        --start;
     }
 
-    return node;
+    ++count_;
 }
 
 template <class T>
 void Deque<T>::pop_back() {
-    list.remove(back_node());
+    T* last = &back();
+
+    std::allocator_traits<allocator_type>::destroy(alloc, last);
     --count_;
+
+    if (!count_) {
+        release_blocks();
+    } else if ((start + count_) % block_size == 0) {
+        spare.append(map[--map_end]);
+    }
 }
 
 template <class T>
 void Deque<T>::pop_front() {
-    list.remove(front_node());
+    T* first = &front();
+
+    std::allocator_traits<allocator_type>::destroy(alloc, first);
     --count_;
+
+    if (!count_) {
+        release_blocks();
+    } else if (++start == block_size) {
+        spare.append(map[map_begin++]);
+        start = 0;
+    }
 }
 
 template <class T>
@@ -102,7 +227,11 @@ T& Deque<T>::back() {
 
 template <class T>
 const T& Deque<T>::back() const {
-    return back_node()->element();
+    if (!count_) {
+        throw except::BufferEmpty();
+    }
+
+    return *at(count_ - 1);
 }
 
 template <class T>
@@ -112,7 +241,11 @@ T& Deque<T>::front() {
 
 template <class T>
 const T& Deque<T>::front() const {
-    return front_node()->element();
+    if (!count_) {
+        throw except::BufferEmpty();
+    }
+
+    return *at(0);
 }
 
 template <class T>
@@ -120,6 +253,130 @@ std::size_t Deque<T>::count() const {
     return count_;
 }
 
+template <class T>
+void Deque<T>::clear() {
+    for (std::size_t i = 0; i < count_; ++i) {
+        std::allocator_traits<allocator_type>::destroy(alloc, at(i));
+    }
+
+    count_ = 0;
+    release_blocks();
+}
+
+template <class T>
+void Deque<T>::shrink_to_fit() {
+    for (std::size_t i = 0; i < spare.count(); ++i) {
+        std::allocator_traits<allocator_type>::deallocate(alloc, spare[i],
+                block_size);
+    }
+
+    spare.clear();
+}
+
+template <class T>
+T& Deque<T>::operator[](std::size_t index) {
+    return const_cast<T&>(static_cast<const Deque<T>&>(*this)[index]);
+}
+
+template <class T>
+const T& Deque<T>::operator[](std::size_t index) const {
+    if (index >= count_) {
+        throw std::out_of_range("");
+    }
+
+    return *at(index);
+}
+
+template <class T>
+Deque<T>& Deque<T>::operator=(const Deque<T>& rhs) & {
+    if (this != &rhs) {
+        Deque<T> tmp(rhs);
+        swap(tmp);
+    }
+
+    return *this;
+}
+
+template <class T>
+Deque<T>& Deque<T>::operator=(Deque<T>&& rhs) & noexcept {
+    swap(rhs);
+
+    return *this;
+}
+
+template <class T>
+T* Deque<T>::at(std::size_t index) const {
+    std::size_t offset = start + index;
+
+    return &map[map_begin + offset / block_size][offset % block_size];
+}
+
+template <class T>
+T* Deque<T>::acquire_block() {
+    if (spare.count()) {
+        T* block = spare[spare.count() - 1];
+        spare.remove(spare.count() - 1);
+
+        return block;
+    }
+
+    return std::allocator_traits<allocator_type>::allocate(alloc, block_size);
+}
+
+template <class T>
+void Deque<T>::release_blocks() {
+    for (std::size_t i = map_begin; i < map_end; ++i) {
+        spare.append(map[i]);
+    }
+
+    map_begin = map_end = map_capacity / 2;
+    start = 0;
+}
+
+template <class T>
+void Deque<T>::remap() {
+    std::size_t used = map_end - map_begin;
+
+    if (map_capacity >= 2 * used + 2) {
+        std::size_t new_begin = (map_capacity - used) / 2;
+
+        if (new_begin < map_begin) {
+            std::copy(map + map_begin, map + map_end, map + new_begin);
+        } else {
+            std::copy_backward(map + map_begin, map + map_end,
+                    map + new_begin + used);
+        }
+
+        map_begin = new_begin;
+        map_end = new_begin + used;
+
+        return;
+    }
+
+    std::size_t new_capacity = std::max<std::size_t>(2 * map_capacity, 8);
+    std::size_t new_begin = (new_capacity - used) / 2;
+    T** new_map = new T*[new_capacity];
+
+    std::copy(map + map_begin, map + map_end, new_map + new_begin);
+    delete[] map;
+
+    map = new_map;
+    map_capacity = new_capacity;
+    map_begin = new_begin;
+    map_end = new_begin + used;
+}
+
+template <class T>
+void Deque<T>::swap(Deque<T>& rhs) noexcept {
+    std::swap(map, rhs.map);
+    std::swap(map_capacity, rhs.map_capacity);
+    std::swap(map_begin, rhs.map_begin);
+    std::swap(map_end, rhs.map_end);
+    std::swap(start, rhs.start);
+    std::swap(count_, rhs.count_);
+    std::swap(spare, rhs.spare);
+}
+
 }
 }
 
@@ -6,6 +6,7 @@
 #include <initializer_list>
 #include <memory>
 #include <stdexcept>
+#include <utility>
 
 #include "alg/common/utils.h"
 
@@ -36,8 +37,13 @@ public:
 
     void add(std::size_t index, const T& element);
     void append(const T& element);
+    void append(T&& element);
+
+    template <class... Args>
+    void emplace_back(Args&&... args);
 
     void remove(std::size_t index);
+    void clear();
 
     T& operator[](std::size_t index);
     const T& operator[](std::size_t index) const;
@@ -51,6 +57,8 @@ private:
     T* buffer{nullptr};
     std::size_t capacity_{0};
     std::size_t count_{0};
+
+    void relocate(T* tmp_buffer, std::size_t new_capacity);
 };
 
 template <class T>
@@ -108,15 +116,13 @@ void ExtendableArray<T>::reserve(std::size_t new_capacity) {
     T* tmp_buffer = std::allocator_traits<allocator_type>::allocate(alloc,
             new_capacity);
 
-    for (std::size_t i = 0; i < count_; ++i) {
-        std::allocator_traits<allocator_type>::construct(alloc,
-                &tmp_buffer[i], buffer[i]);
+    try {
+        relocate(tmp_buffer, new_capacity);
+    } catch (...) {
+        std::allocator_traits<allocator_type>::deallocate(alloc, tmp_buffer,
+                new_capacity);
+        throw;
     }
-
-    utils::clear_buffer(buffer, alloc, 0, count_, capacity_, true);
-
-    buffer = tmp_buffer;
-    capacity_ = new_capacity;
 }
 
 template <class T>
@@ -156,10 +162,10 @@ void ExtendableArray<T>::add(std::size_t index, const T& element) {
                 &buffer[count_], element);
     } else {
         std::allocator_traits<allocator_type>::construct(alloc,
-                &buffer[count_], buffer[count_ - 1]);
+                &buffer[count_], std::move(buffer[count_ - 1]));
 
         for (int i = count_ - 2; i >= static_cast<int>(index); --i) {
-            buffer[i + 1] = buffer[i];
+            buffer[i + 1] = std::move(buffer[i]);
         }
 
         buffer[index] = element;
@@ -170,7 +176,49 @@ void ExtendableArray<T>::add(std::size_t index, const T& element) {
 
 template <class T>
 void ExtendableArray<T>::append(const T& element) {
-    add(count_, element);
+    emplace_back(element);
+}
+
+template <class T>
+void ExtendableArray<T>::append(T&& element) {
+    emplace_back(std::move(element));
+}
+
+template <class T>
+template <class... Args>
+void ExtendableArray<T>::emplace_back(Args&&... args) {
+    if (count_ < capacity_) {
+        std::allocator_traits<allocator_type>::construct(alloc,
+                &buffer[count_], std::forward<Args>(args)...);
+
+        ++count_;
+        return;
+    }
+
+    std::size_t new_capacity = capacity_ ? capacity_ * 2 : 1;
+    T* tmp_buffer = std::allocator_traits<allocator_type>::allocate(alloc,
+            new_capacity);
+
+    try {
+        std::allocator_traits<allocator_type>::construct(alloc,
+                &tmp_buffer[count_], std::forward<Args>(args)...);
+    } catch (...) {
+        std::allocator_traits<allocator_type>::deallocate(alloc, tmp_buffer,
+                new_capacity);
+        throw;
+    }
+
+    try {
+        relocate(tmp_buffer, new_capacity);
+    } catch (...) {
+        std::allocator_traits<allocator_type>::destroy(alloc,
+                &tmp_buffer[count_]);
+        std::allocator_traits<allocator_type>::deallocate(alloc, tmp_buffer,
+                new_capacity);
+        throw;
+    }
+
+    ++count_;
 }
 
 template <class T>
@@ -180,7 +228,7 @@ void ExtendableArray<T>::remove(std::size_t index) {
     }
 
     for (std::size_t i = index + 1; i < count_; ++i) {
-        buffer[i - 1] = buffer[i];
+        buffer[i - 1] = std::move(buffer[i]);
     }
 
     std::allocator_traits<allocator_type>::destroy(alloc, &buffer[count_ - 1]);
@@ -188,6 +236,13 @@ void ExtendableArray<T>::remove(std::size_t index) {
     --count_;
 }
 
+template <class T>
+void ExtendableArray<T>::clear() {
+    utils::clear_buffer(buffer, alloc, 0, count_, capacity_, false);
+
+    count_ = 0;
+}
+
 template <class T>
 T& ExtendableArray<T>::operator[](std::size_t index) {
     return const_cast<T&>(static_cast<const ExtendableArray<T>&>(*this)[index]);
@@ -255,6 +310,29 @@ ExtendableArray<T>& ExtendableArray<T>::operator=(
     return *this;
 }
 
+template <class T>
+void ExtendableArray<T>::relocate(T* tmp_buffer, std::size_t new_capacity) {
+    std::size_t i = 0;
+
+    try {
+        for ( ; i < count_; ++i) {
+            std::allocator_traits<allocator_type>::construct(alloc,
+                    &tmp_buffer[i], std::move_if_noexcept(buffer[i]));
+        }
+    } catch (...) {
+        while (i--) {
+            std::allocator_traits<allocator_type>::destroy(alloc,
+                    &tmp_buffer[i]);
+        }
+        throw;
+    }
+
+    utils::clear_buffer(buffer, alloc, 0, count_, capacity_, true);
+
+    buffer = tmp_buffer;
+    capacity_ = new_capacity;
+}
+
 }
 }
 
@@ -0,0 +1,347 @@
+#ifndef ALG_DS_EXTENDABLE_QUEUE_H_
+#define ALG_DS_EXTENDABLE_QUEUE_H_
+
+#include <cstddef>
+
+#include <algorithm>
+#include <memory>
+#include <utility>
+
+#include "alg/common/exception.h"
+
+namespace alg {
+namespace ds {
+
+template <class T>
+class ExtendableQueue {
+public:
+    using allocator_type = std::allocator<T>;
+
+    ExtendableQueue() = default;
+    explicit ExtendableQueue(std::size_t capacity);
+
+    ExtendableQueue(const ExtendableQueue<T>& rhs);
+    ExtendableQueue(ExtendableQueue<T>&& rhs) noexcept;
+
+    ~ExtendableQueue();
+
+    void enqueue(const T& element);
+    void enqueue(T&& element);
+
+    template <class... Args>
+    void emplace(Args&&... args);
+
+    T dequeue();
+
+    template <class InputIt>
+    void enqueue_bulk(InputIt first, std::size_t n);
+
+    template <class OutputIt>
+    std::size_t dequeue_bulk(OutputIt out, std::size_t n);
+
+    T& front();
+    const T& front() const;
+
+    std::size_t count() const;
+    std::size_t capacity() const;
+
+    void reserve(std::size_t new_capacity);
+    void clear();
+
+    ExtendableQueue<T>& operator=(const ExtendableQueue<T>& rhs) &;
+    ExtendableQueue<T>& operator=(ExtendableQueue<T>&& rhs) & noexcept;
+
+private:
+    allocator_type alloc;
+
+    T* buffer{nullptr};
+    std::size_t capacity_{0};
+    std::size_t head{0};
+    std::size_t count_{0};
+
+    T* slot(std::size_t i) const;
+
+    std::size_t grown_capacity(std::size_t needed) const;
+    void grow(std::size_t needed);
+    void relocate(T* tmp_buffer, std::size_t new_capacity);
+};
+
+template <class T>
+ExtendableQueue<T>::ExtendableQueue(std::size_t capacity) {
+    reserve(capacity);
+}
+
+template <class T>
+ExtendableQueue<T>::ExtendableQueue(const ExtendableQueue<T>& rhs) {
+    reserve(rhs.count_);
+
+    for ( ; count_ < rhs.count_; ++count_) {
+        std::allocator_traits<allocator_type>::construct(alloc,
+                &buffer[count_], *rhs.slot(count_));
+    }
+}
+
+template <class T>
+ExtendableQueue<T>::ExtendableQueue(ExtendableQueue<T>&& rhs) noexcept :
+    buffer{rhs.buffer},
+    capacity_{rhs.capacity_},
+    head{rhs.head},
+    count_{rhs.count_} {
+
+    rhs.buffer = nullptr;
+    rhs.capacity_ = 0;
+    rhs.head = 0;
+    rhs.count_ = 0;
+}
+
+template <class T>
+ExtendableQueue<T>::~ExtendableQueue() {
+    clear();
+
+    if (buffer) {
+        std::allocator_traits<allocator_type>::deallocate(alloc, buffer,
+                capacity_);
+    }
+}
+
+template <class T>
+void ExtendableQueue<T>::enqueue(const T& element) {
+    emplace(element);
+}
+
+template <class T>
+void ExtendableQueue<T>::enqueue(T&& element) {
+    emplace(std::move(element));
+}
+
+template <class T>
+template <class... Args>
+void ExtendableQueue<T>::emplace(Args&&... args) {
+    if (count_ < capacity_) {
+        std::allocator_traits<allocator_type>::construct(alloc, slot(count_),
+                std::forward<Args>(args)...);
+
+        ++count_;
+        return;
+    }
+
+    std::size_t new_capacity = grown_capacity(count_ + 1);
+    T* tmp_buffer = std::allocator_traits<allocator_type>::allocate(alloc,
+            new_capacity);
+
+    try {
+        std::allocator_traits<allocator_type>::construct(alloc,
+                &tmp_buffer[count_], std::forward<Args>(args)...);
+    } catch (...) {
+        std::allocator_traits<allocator_type>::deallocate(alloc, tmp_buffer,
+                new_capacity);
+        throw;
+    }
+
+    try {
+        relocate(tmp_buffer, new_capacity);
+    } catch (...) {
+        std::allocator_traits<allocator_type>::destroy(alloc,
+                &tmp_buffer[count_]);
+        std::allocator_traits<allocator_type>::deallocate(alloc, tmp_buffer,
+                new_capacity);
+        throw;
+    }
+
+    ++count_;
+}
+
+template <class T>
+T ExtendableQueue<T>::dequeue() {
+    if (!count_) {
+        throw except::BufferEmpty();
+    }
+
+    T* first = slot(0);
+    T element = std::move(*first);
+
+    std::allocator_traits<allocator_type>::destroy(alloc, first);
+
+    head = (head + 1) & (capacity_ - 1);
+    --count_;
+
+    return element;
+}
+
+template <class T>
+template <class InputIt>
+void ExtendableQueue<T>::enqueue_bulk(InputIt first, std::size_t n) {
+    if (count_ + n > capacity_) {
+        grow(count_ + n);
+    }
+
+    std::size_t tail = (head + count_) & (capacity_ - 1);
+    std::size_t segment = std::min(n, capacity_ - tail);
+
+    for (std::size_t i = 0; i < segment; ++i, ++first, ++count_) {
+        std::allocator_traits<allocator_type>::construct(alloc,
+                &buffer[tail + i], *first);
+    }
+
+    for (std::size_t i = 0; i < n - segment; ++i, ++first, ++count_) {
+        std::allocator_traits<allocator_type>::construct(alloc, &buffer[i],
+                *first);
+    }
+}
+
+template <class T>
+template <class OutputIt>
+std::size_t ExtendableQueue<T>::dequeue_bulk(OutputIt out, std::size_t n) {
+    n = std::min(n, count_);
+
+    std::size_t segment = std::min(n, capacity_ - head);
+
+    for (std::size_t i = 0; i < segment; ++i, ++out) {
+        *out = std::move(buffer[head + i]);
+        std::allocator_traits<allocator_type>::destroy(alloc,
+                &buffer[head + i]);
+    }
+
+    for (std::size_t i = 0; i < n - segment; ++i, ++out) {
+        *out = std::move(buffer[i]);
+        std::allocator_traits<allocator_type>::destroy(alloc, &buffer[i]);
+    }
+
+    if (n) {
+        head = (head + n) & (capacity_ - 1);
+        count_ -= n;
+    }
+
+    return n;
+}
+
+template <class T>
+T& ExtendableQueue<T>::front() {
+    return const_cast<T&>(static_cast<const ExtendableQueue<T>*>(this)->front());
+}
+
+template <class T>
+const T& ExtendableQueue<T>::front() const {
+    if (!count_) {
+        throw except::BufferEmpty();
+    }
+
+    return *slot(0);
+}
+
+template <class T>
+std::size_t ExtendableQueue<T>::count() const {
+    return count_;
+}
+
+template <class T>
+std::size_t ExtendableQueue<T>::capacity() const {
+    return capacity_;
+}
+
+template <class T>
+void ExtendableQueue<T>::reserve(std::size_t new_capacity) {
+    if (new_capacity > capacity_) {
+        grow(new_capacity);
+    }
+}
+
+template <class T>
+void ExtendableQueue<T>::clear() {
+    for (std::size_t i = 0; i < count_; ++i) {
+        std::allocator_traits<allocator_type>::destroy(alloc, slot(i));
+    }
+
+    head = 0;
+    count_ = 0;
+}
+
+template <class T>
+ExtendableQueue<T>& ExtendableQueue<T>::operator=(
+        const ExtendableQueue<T>& rhs) & {
+
+    if (this != &rhs) {
+        *this = ExtendableQueue<T>(rhs);
+    }
+
+    return *this;
+}
+
+template <class T>
+ExtendableQueue<T>& ExtendableQueue<T>::operator=(
+        ExtendableQueue<T>&& rhs) & noexcept {
+
+    std::swap(buffer, rhs.buffer);
+    std::swap(capacity_, rhs.capacity_);
+    std::swap(head, rhs.head);
+    std::swap(count_, rhs.count_);
+
+    return *this;
+}
+
+template <class T>
+T* ExtendableQueue<T>::slot(std::size_t i) const {
+    return &buffer[(head + i) & (capacity_ - 1)];
+}
+
+template <class T>
+std::size_t ExtendableQueue<T>::grown_capacity(std::size_t needed) const {
+    std::size_t new_capacity = capacity_ ? capacity_ : 1;
+
+    while (new_capacity < needed) {
+        new_capacity <<= 1;
+    }
+
+    return new_capacity;
+}
+
+template <class T>
+void ExtendableQueue<T>::grow(std::size_t needed) {
+    std::size_t new_capacity = grown_capacity(needed);
+    T* tmp_buffer = std::allocator_traits<allocator_type>::allocate(alloc,
+            new_capacity);
+
+    try {
+        relocate(tmp_buffer, new_capacity);
+    } catch (...) {
+        std::allocator_traits<allocator_type>::deallocate(alloc, tmp_buffer,
+                new_capacity);
+        throw;
+    }
+}
+
+template <class T>
+void ExtendableQueue<T>::relocate(T* tmp_buffer, std::size_t new_capacity) {
+    std::size_t i = 0;
+
+    try {
+        for ( ; i < count_; ++i) {
+            std::allocator_traits<allocator_type>::construct(alloc,
+                    &tmp_buffer[i], std::move_if_noexcept(*slot(i)));
+        }
+    } catch (...) {
+        while (i--) {
+            std::allocator_traits<allocator_type>::destroy(alloc,
+                    &tmp_buffer[i]);
+        }
+        throw;
+    }
+
+    for (i = 0; i < count_; ++i) {
+        std::allocator_traits<allocator_type>::destroy(alloc, slot(i));
+    }
+
+    if (buffer) {
+        std::allocator_traits<allocator_type>::deallocate(alloc, buffer,
+                capacity_);
+    }
+
+    buffer = tmp_buffer;
+    capacity_ = new_capacity;
+    head = 0;
+}
+
+}
+}
+
+#endif
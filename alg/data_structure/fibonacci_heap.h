@@ -0,0 +1,553 @@
+#ifndef ALG_DS_FIBONACCI_HEAP_H_
+#define ALG_DS_FIBONACCI_HEAP_H_
+
+#include <cstddef>
+#include <cstdint>
+
+#include <algorithm>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "alg/common/exception.h"
+#include "alg/common/node_pool.h"
+#include "alg/data_structure/priority_queue.h"
+
+namespace alg {
+namespace ds {
+
+template <class T>
+class FibonacciHeap {
+    class Node;
+
+public:
+    class Handle {
+    public:
+        Handle() = default;
+
+        bool operator==(const Handle& rhs) const {
+            return node == rhs.node && generation == rhs.generation;
+        }
+
+        bool operator!=(const Handle& rhs) const {
+            return !(*this == rhs);
+        }
+
+    private:
+        Node* node{nullptr};
+        std::size_t generation{0};
+
+        Handle(Node* node, std::size_t generation) :
+            node{node}, generation{generation} {}
+
+        friend class FibonacciHeap<T>;
+    };
+
+    explicit FibonacciHeap(PriorityQueueType type);
+
+    FibonacciHeap(const FibonacciHeap<T>&) = delete;
+    FibonacciHeap<T>& operator=(const FibonacciHeap<T>&) = delete;
+
+    ~FibonacciHeap();
+
+    T top();
+    T pop();
+
+    Handle insert(const T& element, std::uint32_t priority);
+    void update_priority(Handle handle, std::uint32_t new_priority);
+    void erase(Handle handle);
+    bool contains(Handle handle) const;
+
+    void meld(FibonacciHeap<T>& rhs);
+
+    std::uint32_t priority(Handle handle) const;
+
+    std::size_t count() const;
+
+private:
+    using allocator_type = std::allocator<T>;
+
+    class Owner {
+    public:
+        Owner* parent{nullptr};
+    };
+
+    class Node {
+    public:
+        typename std::aligned_storage<sizeof(T), alignof(T)>::type storage;
+        std::uint32_t priority{0};
+
+        Node* parent{nullptr};
+        Node* child{nullptr};
+        Node* left{nullptr};
+        Node* right{nullptr};
+
+        std::size_t degree{0};
+        bool mark{false};
+
+        Owner* owner{nullptr};
+        std::size_t generation{0};
+
+        T& element() {
+            return *reinterpret_cast<T*>(&storage);
+        }
+    };
+
+    static constexpr std::size_t max_degree = 128;
+
+    PriorityQueueType type;
+    allocator_type alloc;
+
+    memory::NodePool<Node> pool;
+    memory::NodePool<Owner> owners;
+
+    Owner* owner_{nullptr};
+    Node* free_head{nullptr};
+    Node* free_tail{nullptr};
+
+    Node* top_{nullptr};
+    std::size_t count_{0};
+
+    bool before(std::uint32_t lhs, std::uint32_t rhs) const;
+
+    Node* node_of(Handle handle) const;
+    Owner* current_owner();
+    static Owner* find(Owner* owner);
+
+    template <class... Args>
+    Node* acquire(std::uint32_t priority, Args&&... args);
+    void release(Node* x);
+
+    static void splice(Node* a, Node* b);
+    static void unlink(Node* x);
+
+    void add_root(Node* x);
+    void link(Node* y, Node* x);
+    void cut(Node* x, Node* y);
+    void cascading_cut(Node* y);
+    void consolidate();
+
+    Node* extract_top();
+    Node* extract(Node* x);
+};
+
+template <class T>
+constexpr std::size_t FibonacciHeap<T>::max_degree;
+
+template <class T>
+FibonacciHeap<T>::FibonacciHeap(PriorityQueueType type) : type{type} {
+}
+
+template <class T>
+FibonacciHeap<T>::~FibonacciHeap() {
+    Node* x = top_;
+
+    while (x) {
+        if (x->child) {
+            splice(x, x->child);
+            x->child = nullptr;
+        }
+
+        Node* next = (x->right == x) ? nullptr : x->right;
+
+        unlink(x);
+        std::allocator_traits<allocator_type>::destroy(alloc, &x->element());
+        x = next;
+    }
+}
+
+template <class T>
+T FibonacciHeap<T>::top() {
+    if (!top_) {
+        throw except::BufferEmpty();
+    }
+
+    return top_->element();
+}
+
+template <class T>
+T FibonacciHeap<T>::pop() {
+    if (!top_) {
+        throw except::BufferEmpty();
+    }
+
+    T element = std::move(top_->element());
+
+    release(extract_top());
+
+    return element;
+}
+
+template <class T>
+typename FibonacciHeap<T>::Handle FibonacciHeap<T>::insert(const T& element,
+        std::uint32_t priority) {
+
+    Node* x = acquire(priority, element);
+
+    add_root(x);
+    ++count_;
+
+    return Handle(x, x->generation);
+}
+
+template <class T>
+void FibonacciHeap<T>::update_priority(Handle handle,
+        std::uint32_t new_priority) {
+
+    Node* x = node_of(handle);
+
+    if (before(new_priority, x->priority)) {
+        x->priority = new_priority;
+
+        Node* y = x->parent;
+
+        if (y && before(x->priority, y->priority)) {
+            cut(x, y);
+            cascading_cut(y);
+        }
+
+        if (before(x->priority, top_->priority)) {
+            top_ = x;
+        }
+    } else if (new_priority != x->priority) {
+        extract(x);
+
+        x->priority = new_priority;
+
+        add_root(x);
+        ++count_;
+    }
+}
+
+template <class T>
+void FibonacciHeap<T>::erase(Handle handle) {
+    release(extract(node_of(handle)));
+}
+
+template <class T>
+bool FibonacciHeap<T>::contains(Handle handle) const {
+    return handle.node && handle.node->generation == handle.generation &&
+            owner_ && find(handle.node->owner) == owner_;
+}
+
+template <class T>
+void FibonacciHeap<T>::meld(FibonacciHeap<T>& rhs) {
+    if (this == &rhs) {
+        return;
+    }
+
+    if (type != rhs.type) {
+        throw std::invalid_argument("Heap types differ");
+    }
+
+    Owner* owner = current_owner();
+
+    if (rhs.owner_) {
+        rhs.owner_->parent = owner;
+        rhs.owner_ = nullptr;
+    }
+
+    if (rhs.free_head) {
+        if (free_tail) {
+            free_tail->right = rhs.free_head;
+        } else {
+            free_head = rhs.free_head;
+        }
+        free_tail = rhs.free_tail;
+    }
+
+    if (rhs.top_) {
+        if (!top_) {
+            top_ = rhs.top_;
+        } else {
+            splice(top_, rhs.top_);
+
+            if (before(rhs.top_->priority, top_->priority)) {
+                top_ = rhs.top_;
+            }
+        }
+    }
+
+    count_ += rhs.count_;
+    pool.splice(rhs.pool);
+    owners.splice(rhs.owners);
+
+    rhs.free_head = rhs.free_tail = nullptr;
+    rhs.top_ = nullptr;
+    rhs.count_ = 0;
+}
+
+template <class T>
+std::uint32_t FibonacciHeap<T>::priority(Handle handle) const {
+    return node_of(handle)->priority;
+}
+
+template <class T>
+std::size_t FibonacciHeap<T>::count() const {
+    return count_;
+}
+
+template <class T>
+bool FibonacciHeap<T>::before(std::uint32_t lhs, std::uint32_t rhs) const {
+    return (type == PriorityQueueType::MIN) ? lhs < rhs : lhs > rhs;
+}
+
+template <class T>
+typename FibonacciHeap<T>::Node* FibonacciHeap<T>::node_of(
+        Handle handle) const {
+
+    if (!contains(handle)) {
+        throw except::ItemNotFound();
+    }
+
+    return handle.node;
+}
+
+template <class T>
+typename FibonacciHeap<T>::Owner* FibonacciHeap<T>::current_owner() {
+    if (!owner_) {
+        owner_ = owners.create();
+    }
+
+    return owner_;
+}
+
+template <class T>
+typename FibonacciHeap<T>::Owner* FibonacciHeap<T>::find(Owner* owner) {
+    while (owner->parent) {
+        if (owner->parent->parent) {
+            owner->parent = owner->parent->parent;
+        }
+
+        owner = owner->parent;
+    }
+
+    return owner;
+}
+
+template <class T>
+template <class... Args>
+typename FibonacciHeap<T>::Node* FibonacciHeap<T>::acquire(
+        std::uint32_t priority, Args&&... args) {
+
+    Owner* owner = current_owner();
+
+    if (!free_head) {
+        free_head = free_tail = pool.create();
+    }
+
+    Node* x = free_head;
+
+    std::allocator_traits<allocator_type>::construct(alloc,
+            &x->element(), std::forward<Args>(args)...);
+
+    free_head = x->right;
+
+    if (!free_head) {
+        free_tail = nullptr;
+    }
+
+    x->priority = priority;
+    x->parent = x->child = nullptr;
+    x->left = x->right = x;
+    x->degree = 0;
+    x->mark = false;
+    x->owner = owner;
+
+    return x;
+}
+
+template <class T>
+void FibonacciHeap<T>::release(Node* x) {
+    std::allocator_traits<allocator_type>::destroy(alloc, &x->element());
+
+    ++x->generation;
+    x->right = nullptr;
+
+    if (free_tail) {
+        free_tail->right = x;
+    } else {
+        free_head = x;
+    }
+    free_tail = x;
+}
+
+template <class T>
+void FibonacciHeap<T>::splice(Node* a, Node* b) {
+    Node* a_right = a->right;
+    Node* b_left = b->left;
+
+    a->right = b;
+    b->left = a;
+    a_right->left = b_left;
+    b_left->right = a_right;
+}
+
+template <class T>
+void FibonacciHeap<T>::unlink(Node* x) {
+    x->left->right = x->right;
+    x->right->left = x->left;
+    x->left = x->right = x;
+}
+
+template <class T>
+void FibonacciHeap<T>::add_root(Node* x) {
+    x->parent = nullptr;
+    x->mark = false;
+
+    if (!top_) {
+        top_ = x;
+        return;
+    }
+
+    splice(top_, x);
+
+    if (before(x->priority, top_->priority)) {
+        top_ = x;
+    }
+}
+
+template <class T>
+void FibonacciHeap<T>::link(Node* y, Node* x) {
+    unlink(y);
+
+    y->parent = x;
+    y->mark = false;
+
+    if (!x->child) {
+        x->child = y;
+    } else {
+        splice(x->child, y);
+    }
+
+    ++x->degree;
+}
+
+template <class T>
+void FibonacciHeap<T>::cut(Node* x, Node* y) {
+    if (x->right == x) {
+        y->child = nullptr;
+    } else {
+        if (y->child == x) {
+            y->child = x->right;
+        }
+
+        unlink(x);
+    }
+
+    --y->degree;
+
+    splice(top_, x);
+    x->parent = nullptr;
+    x->mark = false;
+}
+
+template <class T>
+void FibonacciHeap<T>::cascading_cut(Node* y) {
+    Node* z = y->parent;
+
+    while (z) {
+        if (!y->mark) {
+            y->mark = true;
+            break;
+        }
+
+        cut(y, z);
+
+        y = z;
+        z = y->parent;
+    }
+}
+
+template <class T>
+void FibonacciHeap<T>::consolidate() {
+    Node* degrees[max_degree] = {};
+    std::size_t roots = 0;
+    Node* x = top_;
+
+    do {
+        ++roots;
+        x = x->right;
+    } while (x != top_);
+
+    while (roots--) {
+        Node* next = x->right;
+        std::size_t d = x->degree;
+
+        while (degrees[d]) {
+            Node* y = degrees[d];
+
+            if (before(y->priority, x->priority)) {
+                std::swap(x, y);
+            }
+
+            link(y, x);
+            degrees[d++] = nullptr;
+        }
+
+        degrees[d] = x;
+        x = next;
+    }
+
+    top_ = nullptr;
+
+    for (std::size_t d = 0; d < max_degree; ++d) {
+        if (degrees[d] && (!top_ ||
+                before(degrees[d]->priority, top_->priority))) {
+            top_ = degrees[d];
+        }
+    }
+}
+
+template <class T>
+typename FibonacciHeap<T>::Node* FibonacciHeap<T>::extract_top() {
+    Node* z = top_;
+
+    if (z->child) {
+        Node* c = z->child;
+
+        do {
+            c->parent = nullptr;
+            c = c->right;
+        } while (c != z->child);
+
+        splice(z, z->child);
+
+        z->child = nullptr;
+        z->degree = 0;
+    }
+
+    if (z->right == z) {
+        top_ = nullptr;
+    } else {
+        top_ = z->right;
+        unlink(z);
+        consolidate();
+    }
+
+    --count_;
+
+    return z;
+}
+
+template <class T>
+typename FibonacciHeap<T>::Node* FibonacciHeap<T>::extract(Node* x) {
+    if (x != top_) {
+        Node* y = x->parent;
+
+        if (y) {
+            cut(x, y);
+            cascading_cut(y);
+        }
+
+        top_ = x;
+    }
+
+    return extract_top();
+}
+
+}
+}
+
+#endif
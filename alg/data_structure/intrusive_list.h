@@ -0,0 +1,341 @@
+#ifndef ALG_DS_LIST_INTRUSIVE_LIST_H_
+#define ALG_DS_LIST_INTRUSIVE_LIST_H_
+
+#include <cstddef>
+
+#include <iterator>
+
+#include "alg/common/exception.h"
+
+namespace alg {
+namespace ds {
+namespace list {
+
+class Hook;
+
+template <class T, Hook T::*H>
+class IntrusiveList;
+
+class Hook {
+public:
+    Hook() = default;
+
+    Hook(const Hook&) {}
+
+    Hook& operator=(const Hook&) {
+        return *this;
+    }
+
+    bool is_linked() const {
+        return next != nullptr;
+    }
+
+private:
+    Hook* next{nullptr};
+    Hook* prev{nullptr};
+    void* owner{nullptr};
+    const void* list{nullptr};
+
+    template <class T, Hook T::*H>
+    friend class IntrusiveList;
+};
+
+template <class T, Hook T::*H>
+class IntrusiveList {
+    template <class U>
+    class Iter;
+
+public:
+    using iterator = Iter<T>;
+    using const_iterator = Iter<const T>;
+
+    IntrusiveList();
+
+    IntrusiveList(const IntrusiveList<T, H>&) = delete;
+    IntrusiveList<T, H>& operator=(const IntrusiveList<T, H>&) = delete;
+
+    ~IntrusiveList();
+
+    void push_front(T& element);
+    void push_back(T& element);
+
+    void insert_before(T& position, T& element);
+    void insert_after(T& position, T& element);
+
+    void remove(T& element);
+
+    T& pop_front();
+    T& pop_back();
+
+    T& front();
+    const T& front() const;
+
+    T& back();
+    const T& back() const;
+
+    T* after(const T& element);
+    T* before(const T& element);
+
+    void clear();
+
+    std::size_t count() const;
+
+    iterator begin();
+    iterator end();
+
+    const_iterator begin() const;
+    const_iterator end() const;
+
+private:
+    template <class U>
+    class Iter {
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = U*;
+        using reference = U&;
+
+        Iter() = default;
+
+        reference operator*() const {
+            return *IntrusiveList<T, H>::owner(hook);
+        }
+
+        pointer operator->() const {
+            return IntrusiveList<T, H>::owner(hook);
+        }
+
+        Iter& operator++() {
+            hook = hook->next;
+            return *this;
+        }
+
+        Iter operator++(int) {
+            Iter old = *this;
+            hook = hook->next;
+            return old;
+        }
+
+        Iter& operator--() {
+            hook = hook->prev;
+            return *this;
+        }
+
+        Iter operator--(int) {
+            Iter old = *this;
+            hook = hook->prev;
+            return old;
+        }
+
+        bool operator==(const Iter& rhs) const {
+            return hook == rhs.hook;
+        }
+
+        bool operator!=(const Iter& rhs) const {
+            return hook != rhs.hook;
+        }
+
+    private:
+        Hook* hook{nullptr};
+
+        explicit Iter(Hook* hook) : hook{hook} {}
+
+        friend class IntrusiveList<T, H>;
+    };
+
+    Hook root;
+    std::size_t count_{0};
+
+    static T* owner(Hook* hook);
+
+    Hook* linked_hook(const T& element) const;
+
+    void link(Hook* position, T& element);
+    static void unlink(Hook* hook);
+};
+
+template <class T, Hook T::*H>
+IntrusiveList<T, H>::IntrusiveList() {
+    root.next = root.prev = &root;
+}
+
+template <class T, Hook T::*H>
+IntrusiveList<T, H>::~IntrusiveList() {
+    clear();
+}
+
+template <class T, Hook T::*H>
+void IntrusiveList<T, H>::push_front(T& element) {
+    link(root.next, element);
+}
+
+template <class T, Hook T::*H>
+void IntrusiveList<T, H>::push_back(T& element) {
+    link(&root, element);
+}
+
+template <class T, Hook T::*H>
+void IntrusiveList<T, H>::insert_before(T& position, T& element) {
+    link(linked_hook(position), element);
+}
+
+template <class T, Hook T::*H>
+void IntrusiveList<T, H>::insert_after(T& position, T& element) {
+    link(linked_hook(position)->next, element);
+}
+
+template <class T, Hook T::*H>
+void IntrusiveList<T, H>::remove(T& element) {
+    unlink(linked_hook(element));
+    --count_;
+}
+
+template <class T, Hook T::*H>
+T& IntrusiveList<T, H>::pop_front() {
+    T& element = front();
+
+    remove(element);
+
+    return element;
+}
+
+template <class T, Hook T::*H>
+T& IntrusiveList<T, H>::pop_back() {
+    T& element = back();
+
+    remove(element);
+
+    return element;
+}
+
+template <class T, Hook T::*H>
+T& IntrusiveList<T, H>::front() {
+    return const_cast<T&>(static_cast<const IntrusiveList<T, H>*>(this)->front());
+}
+
+template <class T, Hook T::*H>
+const T& IntrusiveList<T, H>::front() const {
+    if (!count_) {
+        throw except::BufferEmpty();
+    }
+
+    return *owner(root.next);
+}
+
+template <class T, Hook T::*H>
+T& IntrusiveList<T, H>::back() {
+    return const_cast<T&>(static_cast<const IntrusiveList<T, H>*>(this)->back());
+}
+
+template <class T, Hook T::*H>
+const T& IntrusiveList<T, H>::back() const {
+    if (!count_) {
+        throw except::BufferEmpty();
+    }
+
+    return *owner(root.prev);
+}
+
+template <class T, Hook T::*H>
+T* IntrusiveList<T, H>::after(const T& element) {
+    Hook* next = linked_hook(element)->next;
+
+    return next == &root ? nullptr : owner(next);
+}
+
+template <class T, Hook T::*H>
+T* IntrusiveList<T, H>::before(const T& element) {
+    Hook* prev = linked_hook(element)->prev;
+
+    return prev == &root ? nullptr : owner(prev);
+}
+
+template <class T, Hook T::*H>
+void IntrusiveList<T, H>::clear() {
+    Hook* hook = root.next;
+
+    while (hook != &root) {
+        Hook* next = hook->next;
+
+        hook->next = hook->prev = nullptr;
+        hook->list = nullptr;
+        hook = next;
+    }
+
+    root.next = root.prev = &root;
+    count_ = 0;
+}
+
+template <class T, Hook T::*H>
+std::size_t IntrusiveList<T, H>::count() const {
+    return count_;
+}
+
+template <class T, Hook T::*H>
+typename IntrusiveList<T, H>::iterator IntrusiveList<T, H>::begin() {
+    return iterator(root.next);
+}
+
+template <class T, Hook T::*H>
+typename IntrusiveList<T, H>::iterator IntrusiveList<T, H>::end() {
+    return iterator(&root);
+}
+
+template <class T, Hook T::*H>
+typename IntrusiveList<T, H>::const_iterator IntrusiveList<T, H>::begin() const {
+    return const_iterator(root.next);
+}
+
+template <class T, Hook T::*H>
+typename IntrusiveList<T, H>::const_iterator IntrusiveList<T, H>::end() const {
+    return const_iterator(const_cast<Hook*>(&root));
+}
+
+template <class T, Hook T::*H>
+T* IntrusiveList<T, H>::owner(Hook* hook) {
+    return static_cast<T*>(hook->owner);
+}
+
+template <class T, Hook T::*H>
+Hook* IntrusiveList<T, H>::linked_hook(const T& element) const {
+    Hook* hook = const_cast<Hook*>(&(element.*H));
+
+    if (hook->list != this) {
+        throw except::ItemNotFound();
+    }
+
+    return hook;
+}
+
+template <class T, Hook T::*H>
+void IntrusiveList<T, H>::link(Hook* position, T& element) {
+    Hook* hook = &(element.*H);
+
+    if (hook->is_linked()) {
+        throw except::ItemExists();
+    }
+
+    hook->owner = &element;
+    hook->list = this;
+    hook->next = position;
+    hook->prev = position->prev;
+    position->prev->next = hook;
+    position->prev = hook;
+
+    ++count_;
+}
+
+template <class T, Hook T::*H>
+void IntrusiveList<T, H>::unlink(Hook* hook) {
+    hook->prev->next = hook->next;
+    hook->next->prev = hook->prev;
+    hook->next = hook->prev = nullptr;
+    hook->list = nullptr;
+}
+
+}
+}
+}
+
+#endif
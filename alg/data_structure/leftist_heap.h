@@ -0,0 +1,339 @@
+#ifndef ALG_DS_LEFTIST_HEAP_H_
+#define ALG_DS_LEFTIST_HEAP_H_
+
+#include <cstddef>
+#include <cstdint>
+
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+
+#include "alg/common/exception.h"
+#include "alg/common/node_pool.h"
+#include "alg/data_structure/extendable_array.h"
+#include "alg/data_structure/priority_queue.h"
+
+namespace alg {
+namespace ds {
+
+template <class T>
+class LeftistHeap {
+public:
+    explicit LeftistHeap(PriorityQueueType type);
+
+    template <class InputIt>
+    LeftistHeap(PriorityQueueType type, InputIt first, InputIt last);
+
+    LeftistHeap(const LeftistHeap<T>&) = delete;
+    LeftistHeap<T>& operator=(const LeftistHeap<T>&) = delete;
+
+    ~LeftistHeap();
+
+    T& top();
+    const T& top() const;
+    T pop();
+
+    std::uint32_t top_priority() const;
+
+    void insert(const T& element, std::uint32_t priority);
+    void insert(T&& element, std::uint32_t priority);
+
+    template <class... Args>
+    void emplace(std::uint32_t priority, Args&&... args);
+
+    template <class InputIt>
+    void insert_bulk(InputIt first, InputIt last);
+
+    void meld(LeftistHeap<T>& rhs);
+
+    template <class InputIt>
+    void meld_bulk(InputIt first, InputIt last);
+
+    std::size_t count() const;
+
+private:
+    class Node {
+    public:
+        T element;
+        std::uint32_t priority;
+
+        Node* left{nullptr};
+        Node* right{nullptr};
+        std::size_t rank{1};
+
+        template <class... Args>
+        Node(std::uint32_t priority, Args&&... args) :
+            element(std::forward<Args>(args)...),
+            priority{priority} {}
+    };
+
+    PriorityQueueType type;
+    memory::NodePool<Node> pool;
+
+    Node* root{nullptr};
+    std::size_t count_{0};
+
+    bool before(std::uint32_t lhs, std::uint32_t rhs) const;
+
+    static std::size_t rank(const Node* node);
+
+    Node* merge(Node* a, Node* b);
+    Node* merge_all(ExtendableArray<Node*>& roots);
+
+    void absorb(LeftistHeap<T>& rhs);
+};
+
+template <class T>
+LeftistHeap<T>::LeftistHeap(PriorityQueueType type) : type{type} {
+}
+
+template <class T>
+template <class InputIt>
+LeftistHeap<T>::LeftistHeap(PriorityQueueType type, InputIt first,
+        InputIt last) : LeftistHeap(type) {
+
+    insert_bulk(first, last);
+}
+
+template <class T>
+LeftistHeap<T>::~LeftistHeap() {
+    Node* node = root;
+
+    while (node) {
+        if (node->left) {
+            Node* left = node->left;
+
+            node->left = left->right;
+            left->right = node;
+            node = left;
+        } else {
+            Node* right = node->right;
+
+            pool.destroy(node);
+            node = right;
+        }
+    }
+}
+
+template <class T>
+T& LeftistHeap<T>::top() {
+    return const_cast<T&>(static_cast<const LeftistHeap<T>*>(this)->top());
+}
+
+template <class T>
+const T& LeftistHeap<T>::top() const {
+    if (!root) {
+        throw except::BufferEmpty();
+    }
+
+    return root->element;
+}
+
+template <class T>
+T LeftistHeap<T>::pop() {
+    if (!root) {
+        throw except::BufferEmpty();
+    }
+
+    Node* old_root = root;
+    T element = std::move(old_root->element);
+
+    root = merge(old_root->left, old_root->right);
+
+    pool.destroy(old_root);
+    --count_;
+
+    return element;
+}
+
+template <class T>
+std::uint32_t LeftistHeap<T>::top_priority() const {
+    if (!root) {
+        throw except::BufferEmpty();
+    }
+
+    return root->priority;
+}
+
+template <class T>
+void LeftistHeap<T>::insert(const T& element, std::uint32_t priority) {
+    emplace(priority, element);
+}
+
+template <class T>
+void LeftistHeap<T>::insert(T&& element, std::uint32_t priority) {
+    emplace(priority, std::move(element));
+}
+
+template <class T>
+template <class... Args>
+void LeftistHeap<T>::emplace(std::uint32_t priority, Args&&... args) {
+    Node* node = pool.create(priority, std::forward<Args>(args)...);
+
+    root = merge(root, node);
+    ++count_;
+}
+
+template <class T>
+template <class InputIt>
+void LeftistHeap<T>::insert_bulk(InputIt first, InputIt last) {
+    ExtendableArray<Node*> roots;
+
+    if (root) {
+        roots.append(root);
+    }
+
+    Node* created = nullptr;
+
+    try {
+        for ( ; first != last; ++first) {
+            auto&& item = *first;
+
+            created = pool.create(item.second,
+                    std::forward<decltype(item)>(item).first);
+            ++count_;
+
+            roots.append(created);
+            created = nullptr;
+        }
+    } catch (...) {
+        root = merge(merge_all(roots), created);
+        throw;
+    }
+
+    root = merge_all(roots);
+}
+
+template <class T>
+void LeftistHeap<T>::meld(LeftistHeap<T>& rhs) {
+    if (this == &rhs) {
+        return;
+    }
+
+    Node* rhs_root = rhs.root;
+
+    absorb(rhs);
+    root = merge(root, rhs_root);
+}
+
+template <class T>
+template <class InputIt>
+void LeftistHeap<T>::meld_bulk(InputIt first, InputIt last) {
+    ExtendableArray<Node*> roots;
+
+    if (root) {
+        roots.append(root);
+    }
+
+    Node* absorbed = nullptr;
+
+    try {
+        for ( ; first != last; ++first) {
+            LeftistHeap<T>& rhs = **first;
+
+            if (this == &rhs) {
+                continue;
+            }
+
+            Node* rhs_root = rhs.root;
+
+            absorb(rhs);
+            absorbed = rhs_root;
+
+            if (absorbed) {
+                roots.append(absorbed);
+            }
+
+            absorbed = nullptr;
+        }
+    } catch (...) {
+        root = merge(merge_all(roots), absorbed);
+        throw;
+    }
+
+    root = merge_all(roots);
+}
+
+template <class T>
+std::size_t LeftistHeap<T>::count() const {
+    return count_;
+}
+
+template <class T>
+bool LeftistHeap<T>::before(std::uint32_t lhs, std::uint32_t rhs) const {
+    return (type == PriorityQueueType::MIN) ? lhs < rhs : lhs > rhs;
+}
+
+template <class T>
+std::size_t LeftistHeap<T>::rank(const Node* node) {
+    return node ? node->rank : 0;
+}
+
+template <class T>
+typename LeftistHeap<T>::Node* LeftistHeap<T>::merge(Node* a, Node* b) {
+    if (!a) {
+        return b;
+    }
+    if (!b) {
+        return a;
+    }
+
+    if (before(b->priority, a->priority)) {
+        std::swap(a, b);
+    }
+
+    a->right = merge(a->right, b);
+
+    if (rank(a->left) < rank(a->right)) {
+        std::swap(a->left, a->right);
+    }
+
+    a->rank = rank(a->right) + 1;
+
+    return a;
+}
+
+template <class T>
+typename LeftistHeap<T>::Node* LeftistHeap<T>::merge_all(
+        ExtendableArray<Node*>& roots) {
+
+    std::size_t n = roots.count();
+
+    if (!n) {
+        return nullptr;
+    }
+
+    while (n > 1) {
+        std::size_t half = 0;
+
+        for (std::size_t i = 0; i + 1 < n; i += 2) {
+            roots[half++] = merge(roots[i], roots[i + 1]);
+        }
+
+        if (n % 2) {
+            roots[half++] = roots[n - 1];
+        }
+
+        n = half;
+    }
+
+    return roots[0];
+}
+
+template <class T>
+void LeftistHeap<T>::absorb(LeftistHeap<T>& rhs) {
+    if (type != rhs.type) {
+        throw std::invalid_argument("Heap types differ");
+    }
+
+    count_ += rhs.count_;
+    pool.splice(rhs.pool);
+
+    rhs.root = nullptr;
+    rhs.count_ = 0;
+}
+
+}
+}
+
+#endif
@@ -1,7 +1,16 @@
 #ifndef ALG_DS_LIST_LINKED_LIST_H_
 #define ALG_DS_LIST_LINKED_LIST_H_
 
+#include <cstddef>
+
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
 #include "alg/common/iterator.h"
+#include "alg/common/node_pool.h"
 
 namespace alg {
 namespace ds {
@@ -14,6 +23,7 @@ template <class T>
 class Node {
 public:
     explicit Node(const T& element = T());
+    explicit Node(T&& element);
 
     T& element();
     const T& element() const;
@@ -29,7 +39,15 @@ private:
 
 template <class T>
 class LinkedList {
+    template <class U>
+    class Iter;
+
 public:
+    using iterator = Iter<T>;
+    using const_iterator = Iter<const T>;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
     LinkedList();
     ~LinkedList();
 
@@ -55,49 +73,165 @@ public:
 
     void remove(const Node<T>* p);
 
+    void splice(iterator position, LinkedList<T>& other);
+    void splice(iterator position, LinkedList<T>& other, iterator it);
+    void splice(iterator position, LinkedList<T>& other,
+            iterator first, iterator last);
+
+    void merge(LinkedList<T>& other);
+
+    template <class Compare>
+    void merge(LinkedList<T>& other, Compare comp);
+
+    void sort();
+
+    template <class Compare>
+    void sort(Compare comp);
+
+    iterator begin();
+    iterator end();
+
+    const_iterator begin() const;
+    const_iterator end() const;
+
+    reverse_iterator rbegin();
+    reverse_iterator rend();
+
+    const_reverse_iterator rbegin() const;
+    const_reverse_iterator rend() const;
+
     Iterator<T>* create_iterator(bool forward = true);
     void destroy_iterator(Iterator<T>* iter);
 
 private:
+    template <class U>
+    class Iter {
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = U*;
+        using reference = U&;
+
+        Iter() = default;
+
+        template <class V, class = typename std::enable_if<
+                std::is_convertible<V*, U*>::value>::type>
+        Iter(const Iter<V>& rhs) : node{rhs.node} {}
+
+        reference operator*() const {
+            return node->element_;
+        }
+
+        pointer operator->() const {
+            return &node->element_;
+        }
+
+        Iter& operator++() {
+            node = node->next;
+            return *this;
+        }
+
+        Iter operator++(int) {
+            Iter old = *this;
+            node = node->next;
+            return old;
+        }
+
+        Iter& operator--() {
+            node = node->prev;
+            return *this;
+        }
+
+        Iter operator--(int) {
+            Iter old = *this;
+            node = node->prev;
+            return old;
+        }
+
+        bool operator==(const Iter& rhs) const {
+            return node == rhs.node;
+        }
+
+        bool operator!=(const Iter& rhs) const {
+            return node != rhs.node;
+        }
+
+    private:
+        Node<T>* node{nullptr};
+
+        explicit Iter(Node<T>* node) : node{node} {}
+
+        template <class V>
+        friend class Iter;
+
+        friend class LinkedList<T>;
+    };
+
+    class Arena {
+    public:
+        memory::NodePool<Node<T>> pool;
+        std::shared_ptr<Arena> parent;
+    };
+
+    std::shared_ptr<Arena> arena;
+
+    Node<T> head_sentinel;
+    Node<T> tail_sentinel;
+
     Node<T>* head;
     Node<T>* tail;
+
+    memory::NodePool<Node<T>>& pool();
+    void share(LinkedList<T>& other);
+
+    static void transfer(Node<T>* position, Node<T>* first, Node<T>* last);
 };
 
 template <class T>
 class Iterator : public patterns::Iterator<T> {
 public:
-    Iterator(LinkedList<T>* list);
+    explicit Iterator(LinkedList<T>* list) : list{list} {}
     virtual ~Iterator() {}
 
-    virtual bool is_done() const;
-    virtual T current_item() const;
-
 protected:
     LinkedList<T>* list;
-    Node<T>* current;
 };
 
 template <class T>
 class ForwardIterator : public Iterator<T> {
 public:
-    ForwardIterator(LinkedList<T>* list) : Iterator<T>(list) {}
+    explicit ForwardIterator(LinkedList<T>* list) : Iterator<T>(list) {}
 
     void first();
     void next();
+    bool is_done() const;
+    T current_item() const;
+
+private:
+    typename LinkedList<T>::iterator current;
 };
 
 template <class T>
 class BackwardIterator : public Iterator<T> {
 public:
-    BackwardIterator(LinkedList<T>* list) : Iterator<T>(list) {}
+    explicit BackwardIterator(LinkedList<T>* list) : Iterator<T>(list) {}
 
     void first();
     void next();
+    bool is_done() const;
+    T current_item() const;
+
+private:
+    typename LinkedList<T>::reverse_iterator current;
 };
 
 template <class T>
 Node<T>::Node(const T& element) : element_{element} {}
 
+template <class T>
+Node<T>::Node(T&& element) : element_{std::move(element)} {}
+
 template <class T>
 T& Node<T>::element() {
     return element_;
@@ -109,23 +243,32 @@ const T& Node<T>::element() const {
 }
 
 template <class T>
-LinkedList<T>::LinkedList() : head{new Node<T>}, tail{new Node<T>} {
+LinkedList<T>::LinkedList() : head{&head_sentinel}, tail{&tail_sentinel} {
     head->next = tail;
     tail->prev = head;
 }
 
 template <class T>
 LinkedList<T>::~LinkedList() {
+    bool shared = arena && (arena->parent || arena.use_count() > 1);
+
+    if (!shared && std::is_trivially_destructible<T>::value) {
+        return;
+    }
+
     Node<T>* current = head->next;
 
     while (current != tail) {
         Node<T>* next = current->next;
-        delete current;
+
+        if (shared) {
+            pool().destroy(current);
+        } else {
+            current->~Node<T>();
+        }
+
         current = next;
     }
-
-    delete head;
-    delete tail;
 }
 
 template <class T>
@@ -180,7 +323,7 @@ const Node<T>* LinkedList<T>::before(const Node<T>* p) const {
 
 template <class T>
 void LinkedList<T>::insert_after(Node<T>* p, const T& element) {
-    Node<T>* node = new Node<T>(element);
+    Node<T>* node = pool().create(element);
 
     node->next = p->next;
     node->prev = p;
@@ -190,7 +333,7 @@ void LinkedList<T>::insert_after(Node<T>* p, const T& element) {
 
 template <class T>
 void LinkedList<T>::insert_before(Node<T>* p, const T& element) {
-    Node<T>* node = new Node<T>(element);
+    Node<T>* node = pool().create(element);
 
     node->next = p;
     node->prev = p->prev;
@@ -233,7 +376,250 @@ void LinkedList<T>::remove(const Node<T>* p) {
     p->prev->next = p->next;
     p->next->prev = p->prev;
 
-    delete p;
+    pool().destroy(const_cast<Node<T>*>(p));
+}
+
+template <class T>
+void LinkedList<T>::splice(iterator position, LinkedList<T>& other) {
+    if (this == &other || other.head->next == other.tail) {
+        return;
+    }
+
+    share(other);
+    transfer(position.node, other.head->next, other.tail);
+}
+
+template <class T>
+void LinkedList<T>::splice(iterator position, LinkedList<T>& other,
+        iterator it) {
+
+    iterator last = it;
+    splice(position, other, it, ++last);
+}
+
+template <class T>
+void LinkedList<T>::splice(iterator position, LinkedList<T>& other,
+        iterator first, iterator last) {
+
+    if (first == last) {
+        return;
+    }
+
+    if (this == &other) {
+        if (position != first && position != last) {
+            transfer(position.node, first.node, last.node);
+        }
+        return;
+    }
+
+    share(other);
+    transfer(position.node, first.node, last.node);
+}
+
+template <class T>
+void LinkedList<T>::merge(LinkedList<T>& other) {
+    merge(other, std::less<T>());
+}
+
+template <class T>
+template <class Compare>
+void LinkedList<T>::merge(LinkedList<T>& other, Compare comp) {
+    if (this == &other) {
+        return;
+    }
+
+    share(other);
+
+    Node<T>* a = head->next;
+    Node<T>* b = other.head->next;
+
+    while (a != tail && b != other.tail) {
+        if (comp(b->element_, a->element_)) {
+            Node<T>* last = b->next;
+
+            while (last != other.tail && comp(last->element_, a->element_)) {
+                last = last->next;
+            }
+
+            transfer(a, b, last);
+            b = last;
+        } else {
+            a = a->next;
+        }
+    }
+
+    if (b != other.tail) {
+        transfer(tail, b, other.tail);
+    }
+}
+
+template <class T>
+void LinkedList<T>::sort() {
+    sort(std::less<T>());
+}
+
+template <class T>
+template <class Compare>
+void LinkedList<T>::sort(Compare comp) {
+    Node<T>* list = head->next;
+
+    if (list == tail || list->next == tail) {
+        return;
+    }
+
+    tail->prev->next = nullptr;
+
+    for (std::size_t width = 1; ; width *= 2) {
+        Node<T>* p = list;
+        Node<T>* last = nullptr;
+        std::size_t merges = 0;
+
+        list = nullptr;
+
+        while (p) {
+            Node<T>* q = p;
+            std::size_t p_size = 0;
+            std::size_t q_size = width;
+
+            for ( ; q && p_size < width; ++p_size) {
+                q = q->next;
+            }
+
+            while (p_size || (q_size && q)) {
+                Node<T>* e;
+                bool take_p = p_size && (!q_size || !q ||
+                        !comp(q->element_, p->element_));
+
+                if (take_p) {
+                    e = p;
+                    p = p->next;
+                    --p_size;
+                } else {
+                    e = q;
+                    q = q->next;
+                    --q_size;
+                }
+
+                if (last) {
+                    last->next = e;
+                } else {
+                    list = e;
+                }
+                last = e;
+            }
+
+            p = q;
+            ++merges;
+        }
+
+        last->next = nullptr;
+
+        if (merges == 1) {
+            break;
+        }
+    }
+
+    Node<T>* prev = head;
+
+    for (Node<T>* x = list; x; x = x->next) {
+        x->prev = prev;
+        prev->next = x;
+        prev = x;
+    }
+
+    prev->next = tail;
+    tail->prev = prev;
+}
+
+template <class T>
+typename LinkedList<T>::iterator LinkedList<T>::begin() {
+    return iterator(head->next);
+}
+
+template <class T>
+typename LinkedList<T>::iterator LinkedList<T>::end() {
+    return iterator(tail);
+}
+
+template <class T>
+typename LinkedList<T>::const_iterator LinkedList<T>::begin() const {
+    return const_iterator(head->next);
+}
+
+template <class T>
+typename LinkedList<T>::const_iterator LinkedList<T>::end() const {
+    return const_iterator(tail);
+}
+
+template <class T>
+typename LinkedList<T>::reverse_iterator LinkedList<T>::rbegin() {
+    return reverse_iterator(end());
+}
+
+template <class T>
+typename LinkedList<T>::reverse_iterator LinkedList<T>::rend() {
+    return reverse_iterator(begin());
+}
+
+template <class T>
+typename LinkedList<T>::const_reverse_iterator LinkedList<T>::rbegin() const {
+    return const_reverse_iterator(end());
+}
+
+template <class T>
+typename LinkedList<T>::const_reverse_iterator LinkedList<T>::rend() const {
+    return const_reverse_iterator(begin());
+}
+
+template <class T>
+memory::NodePool<Node<T>>& LinkedList<T>::pool() {
+    if (!arena) {
+        arena = std::make_shared<Arena>();
+    }
+
+    while (arena->parent) {
+        arena = arena->parent;
+    }
+
+    return arena->pool;
+}
+
+template <class T>
+void LinkedList<T>::share(LinkedList<T>& other) {
+    if (!other.arena) {
+        return;
+    }
+
+    memory::NodePool<Node<T>>& root = pool();
+    other.pool();
+
+    if (arena == other.arena) {
+        return;
+    }
+
+    root.splice(other.arena->pool);
+
+    other.arena->parent = arena;
+    other.arena = arena;
+}
+
+template <class T>
+void LinkedList<T>::transfer(Node<T>* position, Node<T>* first,
+        Node<T>* last) {
+
+    if (position == last) {
+        return;
+    }
+
+    Node<T>* back = last->prev;
+
+    first->prev->next = last;
+    last->prev = first->prev;
+
+    first->prev = position->prev;
+    back->next = position;
+    position->prev->next = first;
+    position->prev = back;
 }
 
 template <class T>
@@ -257,39 +643,43 @@ void LinkedList<T>::destroy_iterator(Iterator<T>* iter) {
 }
 
 template <class T>
-Iterator<T>::Iterator(LinkedList<T>* list) {
-    this->list = list;
-    current = nullptr;
+void ForwardIterator<T>::first() {
+    current = this->list->begin();
+}
+
+template <class T>
+void ForwardIterator<T>::next() {
+    ++current;
 }
 
 template <class T>
-bool Iterator<T>::is_done() const {
-    return !current;
+bool ForwardIterator<T>::is_done() const {
+    return current == this->list->end();
 }
 
 template <class T>
-T Iterator<T>::current_item() const {
-    return current->element();
+T ForwardIterator<T>::current_item() const {
+    return *current;
 }
 
 template <class T>
-void ForwardIterator<T>::first() {
-    this->current = this->list->first();
+void BackwardIterator<T>::first() {
+    current = this->list->rbegin();
 }
 
 template <class T>
-void ForwardIterator<T>::next() {
-    this->current = this->list->after(this->current);
+void BackwardIterator<T>::next() {
+    ++current;
 }
 
 template <class T>
-void BackwardIterator<T>::first() {
-    this->current = this->list->last();
+bool BackwardIterator<T>::is_done() const {
+    return current == this->list->rend();
 }
 
 template <class T>
-void BackwardIterator<T>::next() {
-    this->current = this->list->before(this->current);
+T BackwardIterator<T>::current_item() const {
+    return *current;
 }
 
 }
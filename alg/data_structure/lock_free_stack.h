@@ -0,0 +1,365 @@
+#ifndef ALG_DS_LOCK_FREE_STACK_H_
+#define ALG_DS_LOCK_FREE_STACK_H_
+
+#include <cstddef>
+#include <cstdint>
+
+#include <atomic>
+#include <memory>
+#include <new>
+#include <random>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+#include "alg/common/exception.h"
+
+namespace alg {
+namespace ds {
+
+template <class T>
+class LockFreeStack {
+public:
+    explicit LockFreeStack(std::size_t elimination_slots = 8);
+
+    LockFreeStack(const LockFreeStack<T>&) = delete;
+    LockFreeStack<T>& operator=(const LockFreeStack<T>&) = delete;
+
+    ~LockFreeStack();
+
+    void push(const T& element);
+    void push(T&& element);
+
+    template <class... Args>
+    void emplace(Args&&... args);
+
+    bool try_pop(T& element);
+
+    std::size_t count() const;
+
+private:
+    static constexpr std::size_t cache_line = 64;
+    static constexpr std::size_t segment_size = 4096;
+    static constexpr std::size_t max_segments = 4096;
+    static constexpr std::size_t elimination_spins = 128;
+
+    class Node {
+    public:
+        std::atomic<std::uint32_t> next{0};
+        std::uint32_t version{0};
+        typename std::aligned_storage<sizeof(T), alignof(T)>::type storage;
+
+        T* element() {
+            return reinterpret_cast<T*>(&storage);
+        }
+    };
+
+    class Exchanger {
+    public:
+        std::atomic<std::uint64_t> value{0};
+
+        char padding[cache_line];
+    };
+
+    std::atomic<std::uint64_t> head{0};
+
+    char padding0[cache_line];
+
+    std::atomic<std::uint64_t> free_head{0};
+    std::atomic<std::uint32_t> next_id{0};
+
+    char padding1[cache_line];
+
+    std::atomic<std::size_t> count_{0};
+
+    std::size_t exchangers_count;
+    std::unique_ptr<Exchanger[]> exchangers;
+    std::unique_ptr<std::atomic<Node*>[]> segments;
+
+    static std::uint64_t pack(std::uint32_t tag, std::uint32_t id);
+    static std::uint32_t tag_of(std::uint64_t word);
+    static std::uint32_t id_of(std::uint64_t word);
+
+    Node& node(std::uint32_t id) const;
+
+    bool push_id(std::atomic<std::uint64_t>& top, std::uint32_t id);
+    std::uint32_t pop_id(std::atomic<std::uint64_t>& top);
+
+    std::uint32_t acquire_node();
+    void release_node(std::uint32_t id);
+
+    bool eliminate_push(std::uint32_t id);
+    std::uint32_t eliminate_pop();
+
+    static std::size_t random(std::size_t n);
+};
+
+template <class T>
+constexpr std::size_t LockFreeStack<T>::cache_line;
+
+template <class T>
+constexpr std::size_t LockFreeStack<T>::segment_size;
+
+template <class T>
+constexpr std::size_t LockFreeStack<T>::max_segments;
+
+template <class T>
+constexpr std::size_t LockFreeStack<T>::elimination_spins;
+
+template <class T>
+LockFreeStack<T>::LockFreeStack(std::size_t elimination_slots) :
+        exchangers_count{elimination_slots},
+        exchangers{new Exchanger[elimination_slots]},
+        segments{new std::atomic<Node*>[max_segments]} {
+
+    for (std::size_t i = 0; i < max_segments; ++i) {
+        segments[i].store(nullptr, std::memory_order_relaxed);
+    }
+}
+
+template <class T>
+LockFreeStack<T>::~LockFreeStack() {
+    std::uint32_t id;
+
+    while ((id = pop_id(head))) {
+        node(id).element()->~T();
+    }
+
+    for (std::size_t i = 0; i < max_segments; ++i) {
+        delete[] segments[i].load(std::memory_order_relaxed);
+    }
+}
+
+template <class T>
+void LockFreeStack<T>::push(const T& element) {
+    emplace(element);
+}
+
+template <class T>
+void LockFreeStack<T>::push(T&& element) {
+    emplace(std::move(element));
+}
+
+template <class T>
+template <class... Args>
+void LockFreeStack<T>::emplace(Args&&... args) {
+    std::uint32_t id = acquire_node();
+
+    try {
+        ::new (static_cast<void*>(node(id).element()))
+                T(std::forward<Args>(args)...);
+    } catch (...) {
+        release_node(id);
+        throw;
+    }
+
+    count_.fetch_add(1, std::memory_order_relaxed);
+
+    while (!push_id(head, id)) {
+        if (eliminate_push(id)) {
+            return;
+        }
+    }
+}
+
+template <class T>
+bool LockFreeStack<T>::try_pop(T& element) {
+    std::uint32_t id;
+
+    while (true) {
+        std::uint64_t top = head.load(std::memory_order_acquire);
+
+        if (!id_of(top)) {
+            id = eliminate_pop();
+
+            if (!id) {
+                return false;
+            }
+
+            break;
+        }
+
+        std::uint32_t next = node(id_of(top)).next.load(
+                std::memory_order_relaxed);
+
+        if (head.compare_exchange_weak(top, pack(tag_of(top) + 1, next),
+                std::memory_order_acquire, std::memory_order_relaxed)) {
+            id = id_of(top);
+            break;
+        }
+
+        if ((id = eliminate_pop())) {
+            break;
+        }
+    }
+
+    count_.fetch_sub(1, std::memory_order_relaxed);
+
+    T* slot = node(id).element();
+
+    element = std::move(*slot);
+    slot->~T();
+    release_node(id);
+
+    return true;
+}
+
+template <class T>
+std::size_t LockFreeStack<T>::count() const {
+    return count_.load(std::memory_order_relaxed);
+}
+
+template <class T>
+std::uint64_t LockFreeStack<T>::pack(std::uint32_t tag, std::uint32_t id) {
+    return (std::uint64_t{tag} << 32) | id;
+}
+
+template <class T>
+std::uint32_t LockFreeStack<T>::tag_of(std::uint64_t word) {
+    return static_cast<std::uint32_t>(word >> 32);
+}
+
+template <class T>
+std::uint32_t LockFreeStack<T>::id_of(std::uint64_t word) {
+    return static_cast<std::uint32_t>(word);
+}
+
+template <class T>
+typename LockFreeStack<T>::Node& LockFreeStack<T>::node(
+        std::uint32_t id) const {
+
+    std::size_t index = id - 1;
+
+    return segments[index / segment_size].load(std::memory_order_acquire)[
+            index % segment_size];
+}
+
+template <class T>
+bool LockFreeStack<T>::push_id(std::atomic<std::uint64_t>& top,
+        std::uint32_t id) {
+
+    std::uint64_t old_top = top.load(std::memory_order_relaxed);
+
+    node(id).next.store(id_of(old_top), std::memory_order_relaxed);
+
+    return top.compare_exchange_weak(old_top, pack(tag_of(old_top) + 1, id),
+            std::memory_order_release, std::memory_order_relaxed);
+}
+
+template <class T>
+std::uint32_t LockFreeStack<T>::pop_id(std::atomic<std::uint64_t>& top) {
+    std::uint64_t old_top = top.load(std::memory_order_acquire);
+
+    while (id_of(old_top)) {
+        std::uint32_t next = node(id_of(old_top)).next.load(
+                std::memory_order_relaxed);
+
+        if (top.compare_exchange_weak(old_top,
+                pack(tag_of(old_top) + 1, next),
+                std::memory_order_acquire, std::memory_order_acquire)) {
+            break;
+        }
+    }
+
+    return id_of(old_top);
+}
+
+template <class T>
+std::uint32_t LockFreeStack<T>::acquire_node() {
+    std::uint32_t id = pop_id(free_head);
+
+    if (!id) {
+        std::size_t index = next_id.fetch_add(1, std::memory_order_relaxed);
+
+        if (index >= segment_size * max_segments) {
+            next_id.fetch_sub(1, std::memory_order_relaxed);
+            throw except::BufferFull();
+        }
+
+        std::atomic<Node*>& segment = segments[index / segment_size];
+
+        if (!segment.load(std::memory_order_acquire)) {
+            Node* fresh = new Node[segment_size];
+            Node* expected = nullptr;
+
+            if (!segment.compare_exchange_strong(expected, fresh,
+                    std::memory_order_acq_rel)) {
+                delete[] fresh;
+            }
+        }
+
+        id = static_cast<std::uint32_t>(index + 1);
+    }
+
+    ++node(id).version;
+
+    return id;
+}
+
+template <class T>
+void LockFreeStack<T>::release_node(std::uint32_t id) {
+    while (!push_id(free_head, id)) {
+    }
+}
+
+template <class T>
+bool LockFreeStack<T>::eliminate_push(std::uint32_t id) {
+    if (!exchangers_count) {
+        return false;
+    }
+
+    std::atomic<std::uint64_t>& slot =
+            exchangers[random(exchangers_count)].value;
+    std::uint64_t offer = pack(node(id).version, id);
+    std::uint64_t expected = 0;
+
+    if (!slot.compare_exchange_strong(expected, offer)) {
+        return false;
+    }
+
+    for (std::size_t i = 0; i < elimination_spins; ++i) {
+        if (slot.load(std::memory_order_relaxed) != offer) {
+            return true;
+        }
+    }
+
+    return !slot.compare_exchange_strong(offer, 0);
+}
+
+template <class T>
+std::uint32_t LockFreeStack<T>::eliminate_pop() {
+    if (!exchangers_count) {
+        return 0;
+    }
+
+    std::atomic<std::uint64_t>& slot =
+            exchangers[random(exchangers_count)].value;
+    std::uint64_t offer = slot.load();
+
+    if (offer && slot.compare_exchange_strong(offer, 0)) {
+        return id_of(offer);
+    }
+
+    return 0;
+}
+
+template <class T>
+std::size_t LockFreeStack<T>::random(std::size_t n) {
+    static thread_local std::uint64_t state = [] {
+        std::random_device rd;
+
+        return (std::uint64_t{rd()} << 32) | rd() | 1;
+    }();
+
+    state ^= state >> 12;
+    state ^= state << 25;
+    state ^= state >> 27;
+
+    return ((state * 0x2545F4914F6CDD1DULL) >> 32) % n;
+}
+
+}
+}
+
+#endif
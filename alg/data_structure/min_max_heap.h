@@ -0,0 +1,269 @@
+#ifndef ALG_DS_HEAP_MIN_MAX_HEAP_H_
+#define ALG_DS_HEAP_MIN_MAX_HEAP_H_
+
+#include <cstddef>
+
+#include <algorithm>
+#include <utility>
+
+#include "alg/common/exception.h"
+#include "alg/data_structure/binary_heap.h"
+#include "alg/data_structure/extendable_array.h"
+
+namespace alg {
+namespace ds {
+namespace heap {
+namespace minmax {
+
+inline bool is_min_level(int i) {
+    int level = 0;
+
+    for (++i; i > 1; i >>= 1) {
+        ++level;
+    }
+
+    return !(level % 2);
+}
+
+template <class T>
+void push_up_min(T* a, int i) {
+    while (i > 2) {
+        int grandparent = binary::parent(binary::parent(i));
+
+        if (!(a[i] < a[grandparent])) {
+            break;
+        }
+
+        std::swap(a[i], a[grandparent]);
+        i = grandparent;
+    }
+}
+
+template <class T>
+void push_up_max(T* a, int i) {
+    while (i > 2) {
+        int grandparent = binary::parent(binary::parent(i));
+
+        if (!(a[grandparent] < a[i])) {
+            break;
+        }
+
+        std::swap(a[i], a[grandparent]);
+        i = grandparent;
+    }
+}
+
+template <class T>
+void push_up(T* a, int i) {
+    if (!i) {
+        return;
+    }
+
+    int parent = binary::parent(i);
+
+    if (is_min_level(i)) {
+        if (a[parent] < a[i]) {
+            std::swap(a[i], a[parent]);
+            push_up_max(a, parent);
+        } else {
+            push_up_min(a, i);
+        }
+    } else {
+        if (a[i] < a[parent]) {
+            std::swap(a[i], a[parent]);
+            push_up_min(a, parent);
+        } else {
+            push_up_max(a, i);
+        }
+    }
+}
+
+template <class T, class Before>
+void trickle_down(T* a, int i, int n, Before before) {
+    while (binary::left(i) < n) {
+        int m = binary::left(i);
+        int last = std::min(binary::right(binary::right(i)), n - 1);
+
+        if (binary::right(i) < n && before(a[binary::right(i)], a[m])) {
+            m = binary::right(i);
+        }
+
+        for (int j = binary::left(binary::left(i)); j <= last; ++j) {
+            if (before(a[j], a[m])) {
+                m = j;
+            }
+        }
+
+        if (!before(a[m], a[i])) {
+            break;
+        }
+
+        std::swap(a[i], a[m]);
+
+        if (m <= binary::right(i)) {
+            break;
+        }
+
+        int parent = binary::parent(m);
+
+        if (before(a[parent], a[m])) {
+            std::swap(a[m], a[parent]);
+        }
+
+        i = m;
+    }
+}
+
+template <class T>
+void trickle_down(T* a, int i, int n) {
+    if (is_min_level(i)) {
+        trickle_down(a, i, n, [](const T& lhs, const T& rhs) {
+            return lhs < rhs;
+        });
+    } else {
+        trickle_down(a, i, n, [](const T& lhs, const T& rhs) {
+            return rhs < lhs;
+        });
+    }
+}
+
+template <class T>
+int max_index(const T* a, int n) {
+    if (n < 3) {
+        return n - 1;
+    }
+
+    return (a[1] < a[2]) ? 2 : 1;
+}
+
+template <class T>
+void pop_min(T* a, int n) {
+    std::swap(a[0], a[n - 1]);
+    trickle_down(a, 0, n - 1);
+}
+
+template <class T>
+void pop_max(T* a, int n) {
+    int m = max_index(a, n);
+
+    std::swap(a[m], a[n - 1]);
+
+    if (m < n - 1) {
+        trickle_down(a, m, n - 1);
+    }
+}
+
+template <class T>
+void build_heap(T* a, int n) {
+    for (int i = binary::parent(n - 1); i >= 0; --i) {
+        trickle_down(a, i, n);
+    }
+}
+
+}
+}
+
+template <class T>
+class MinMaxHeap {
+public:
+    MinMaxHeap() = default;
+
+    template <class InputIt>
+    MinMaxHeap(InputIt first, InputIt last);
+
+    const T& min() const;
+    const T& max() const;
+
+    T pop_min();
+    T pop_max();
+
+    void insert(const T& element);
+    void insert(T&& element);
+
+    std::size_t count() const;
+
+private:
+    ExtendableArray<T> buffer;
+
+    T pop(int index);
+};
+
+template <class T>
+template <class InputIt>
+MinMaxHeap<T>::MinMaxHeap(InputIt first, InputIt last) {
+    for ( ; first != last; ++first) {
+        buffer.emplace_back(*first);
+    }
+
+    heap::minmax::build_heap(buffer.data_ptr(), buffer.count());
+}
+
+template <class T>
+const T& MinMaxHeap<T>::min() const {
+    if (!buffer.count()) {
+        throw except::BufferEmpty();
+    }
+
+    return buffer[0];
+}
+
+template <class T>
+const T& MinMaxHeap<T>::max() const {
+    if (!buffer.count()) {
+        throw except::BufferEmpty();
+    }
+
+    return buffer[heap::minmax::max_index(buffer.data_ptr(), buffer.count())];
+}
+
+template <class T>
+T MinMaxHeap<T>::pop_min() {
+    if (!buffer.count()) {
+        throw except::BufferEmpty();
+    }
+
+    heap::minmax::pop_min(buffer.data_ptr(), buffer.count());
+
+    return pop(buffer.count() - 1);
+}
+
+template <class T>
+T MinMaxHeap<T>::pop_max() {
+    if (!buffer.count()) {
+        throw except::BufferEmpty();
+    }
+
+    heap::minmax::pop_max(buffer.data_ptr(), buffer.count());
+
+    return pop(buffer.count() - 1);
+}
+
+template <class T>
+void MinMaxHeap<T>::insert(const T& element) {
+    buffer.append(element);
+    heap::minmax::push_up(buffer.data_ptr(), buffer.count() - 1);
+}
+
+template <class T>
+void MinMaxHeap<T>::insert(T&& element) {
+    buffer.append(std::move(element));
+    heap::minmax::push_up(buffer.data_ptr(), buffer.count() - 1);
+}
+
+template <class T>
+std::size_t MinMaxHeap<T>::count() const {
+    return buffer.count();
+}
+
+template <class T>
+T MinMaxHeap<T>::pop(int index) {
+    T element = std::move(buffer[index]);
+    buffer.remove(index);
+
+    return element;
+}
+
+}
+}
+
+#endif
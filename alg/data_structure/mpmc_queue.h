@@ -0,0 +1,279 @@
+#ifndef ALG_DS_MPMC_QUEUE_H_
+#define ALG_DS_MPMC_QUEUE_H_
+
+#include <cstddef>
+
+#include <atomic>
+#include <limits>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+namespace alg {
+namespace ds {
+
+template <class T>
+class MpmcQueue {
+public:
+    explicit MpmcQueue(std::size_t n);
+
+    MpmcQueue(const MpmcQueue<T>&) = delete;
+    MpmcQueue<T>& operator=(const MpmcQueue<T>&) = delete;
+
+    ~MpmcQueue();
+
+    bool try_enqueue(const T& element);
+    bool try_enqueue(T&& element);
+
+    template <class... Args>
+    bool try_emplace(Args&&... args);
+
+    bool try_dequeue(T& element);
+
+    void enqueue(const T& element);
+    void enqueue(T&& element);
+    T dequeue();
+
+    std::size_t count() const;
+    std::size_t capacity() const;
+
+private:
+    static constexpr std::size_t cache_line = 64;
+
+    class Cell {
+    public:
+        std::atomic<std::size_t> sequence;
+        typename std::aligned_storage<sizeof(T), alignof(T)>::type storage;
+        bool valid{false};
+
+        T* element() {
+            return reinterpret_cast<T*>(&storage);
+        }
+    };
+
+    std::size_t capacity_;
+    std::size_t mask;
+    std::unique_ptr<Cell[]> cells;
+
+    char padding0[cache_line];
+
+    std::atomic<std::size_t> enqueue_pos{0};
+
+    char padding1[cache_line];
+
+    std::atomic<std::size_t> dequeue_pos{0};
+
+    char padding2[cache_line];
+
+    Cell* claim(std::size_t& pos, bool wait);
+    T release(Cell* cell, std::size_t pos);
+    void discard(Cell* cell, std::size_t pos);
+
+    static std::size_t round_up(std::size_t n);
+};
+
+template <class T>
+constexpr std::size_t MpmcQueue<T>::cache_line;
+
+template <class T>
+MpmcQueue<T>::MpmcQueue(std::size_t n) :
+        capacity_{round_up(n)},
+        mask{capacity_ - 1},
+        cells{new Cell[capacity_]} {
+
+    for (std::size_t i = 0; i < capacity_; ++i) {
+        cells[i].sequence.store(i, std::memory_order_relaxed);
+    }
+}
+
+template <class T>
+MpmcQueue<T>::~MpmcQueue() {
+    std::size_t pos = dequeue_pos.load(std::memory_order_relaxed);
+    std::size_t end = enqueue_pos.load(std::memory_order_relaxed);
+
+    for ( ; pos != end; ++pos) {
+        Cell& cell = cells[pos & mask];
+
+        if (cell.valid) {
+            cell.element()->~T();
+        }
+    }
+}
+
+template <class T>
+bool MpmcQueue<T>::try_enqueue(const T& element) {
+    return try_emplace(element);
+}
+
+template <class T>
+bool MpmcQueue<T>::try_enqueue(T&& element) {
+    return try_emplace(std::move(element));
+}
+
+template <class T>
+template <class... Args>
+bool MpmcQueue<T>::try_emplace(Args&&... args) {
+    std::size_t pos = enqueue_pos.load(std::memory_order_relaxed);
+    Cell* cell;
+
+    while (true) {
+        cell = &cells[pos & mask];
+
+        std::size_t sequence = cell->sequence.load(std::memory_order_acquire);
+        std::ptrdiff_t diff = static_cast<std::ptrdiff_t>(sequence - pos);
+
+        if (!diff) {
+            if (enqueue_pos.compare_exchange_weak(pos, pos + 1,
+                    std::memory_order_relaxed)) {
+                break;
+            }
+        } else if (diff < 0) {
+            return false;
+        } else {
+            pos = enqueue_pos.load(std::memory_order_relaxed);
+        }
+    }
+
+    try {
+        ::new (cell->element()) T(std::forward<Args>(args)...);
+    } catch (...) {
+        cell->valid = false;
+        cell->sequence.store(pos + 1, std::memory_order_release);
+        throw;
+    }
+
+    cell->valid = true;
+    cell->sequence.store(pos + 1, std::memory_order_release);
+
+    return true;
+}
+
+template <class T>
+bool MpmcQueue<T>::try_dequeue(T& element) {
+    while (true) {
+        std::size_t pos;
+        Cell* cell = claim(pos, false);
+
+        if (!cell) {
+            return false;
+        }
+
+        if (cell->valid) {
+            element = release(cell, pos);
+            return true;
+        }
+
+        discard(cell, pos);
+    }
+}
+
+template <class T>
+void MpmcQueue<T>::enqueue(const T& element) {
+    while (!try_emplace(element)) {
+        std::this_thread::yield();
+    }
+}
+
+template <class T>
+void MpmcQueue<T>::enqueue(T&& element) {
+    while (!try_emplace(std::move(element))) {
+        std::this_thread::yield();
+    }
+}
+
+template <class T>
+T MpmcQueue<T>::dequeue() {
+    while (true) {
+        std::size_t pos;
+        Cell* cell = claim(pos, true);
+
+        if (cell->valid) {
+            return release(cell, pos);
+        }
+
+        discard(cell, pos);
+    }
+}
+
+template <class T>
+std::size_t MpmcQueue<T>::count() const {
+    std::size_t end = enqueue_pos.load(std::memory_order_acquire);
+    std::size_t pos = dequeue_pos.load(std::memory_order_acquire);
+
+    return (end - pos <= capacity_) ? end - pos : 0;
+}
+
+template <class T>
+std::size_t MpmcQueue<T>::capacity() const {
+    return capacity_;
+}
+
+template <class T>
+typename MpmcQueue<T>::Cell* MpmcQueue<T>::claim(std::size_t& pos, bool wait) {
+    pos = dequeue_pos.load(std::memory_order_relaxed);
+
+    while (true) {
+        Cell* cell = &cells[pos & mask];
+
+        std::size_t sequence = cell->sequence.load(std::memory_order_acquire);
+        std::ptrdiff_t diff = static_cast<std::ptrdiff_t>(sequence - (pos + 1));
+
+        if (!diff) {
+            if (dequeue_pos.compare_exchange_weak(pos, pos + 1,
+                    std::memory_order_relaxed)) {
+                return cell;
+            }
+        } else if (diff < 0 && !wait) {
+            return nullptr;
+        } else {
+            if (diff < 0) {
+                std::this_thread::yield();
+            }
+
+            pos = dequeue_pos.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+template <class T>
+T MpmcQueue<T>::release(Cell* cell, std::size_t pos) {
+    T* slot = cell->element();
+    T element = std::move(*slot);
+
+    slot->~T();
+    cell->sequence.store(pos + capacity_, std::memory_order_release);
+
+    return element;
+}
+
+template <class T>
+void MpmcQueue<T>::discard(Cell* cell, std::size_t pos) {
+    cell->sequence.store(pos + capacity_, std::memory_order_release);
+}
+
+template <class T>
+std::size_t MpmcQueue<T>::round_up(std::size_t n) {
+    if (!n) {
+        throw std::invalid_argument("Capacity must be positive");
+    }
+
+    if (n > (std::numeric_limits<std::size_t>::max() >> 1) + 1) {
+        throw std::invalid_argument("Capacity is too large");
+    }
+
+    std::size_t capacity = 2;
+
+    while (capacity < n) {
+        capacity <<= 1;
+    }
+
+    return capacity;
+}
+
+}
+}
+
+#endif
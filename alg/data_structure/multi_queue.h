@@ -0,0 +1,225 @@
+#ifndef ALG_DS_MULTI_QUEUE_H_
+#define ALG_DS_MULTI_QUEUE_H_
+
+#include <cstddef>
+#include <cstdint>
+
+#include <algorithm>
+#include <atomic>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <random>
+#include <thread>
+
+#include "alg/data_structure/priority_queue.h"
+
+namespace alg {
+namespace ds {
+
+template <class T>
+class MultiQueue {
+public:
+    explicit MultiQueue(PriorityQueueType type,
+            std::size_t threads = std::thread::hardware_concurrency(),
+            std::size_t factor = 2);
+
+    MultiQueue(const MultiQueue<T>&) = delete;
+    MultiQueue<T>& operator=(const MultiQueue<T>&) = delete;
+
+    ~MultiQueue();
+
+    void push(const T& element, std::uint32_t priority);
+    bool try_pop(T& element);
+
+    std::size_t count() const;
+    std::size_t lanes() const;
+
+private:
+    static constexpr std::uint64_t empty_key = std::uint64_t{1} << 32;
+    static constexpr std::size_t cache_line = 64;
+    static constexpr std::size_t max_attempts = 8;
+
+    class alignas(cache_line) Lane {
+    public:
+        std::mutex lock;
+        PriorityQueue<T> queue{PriorityQueueType::MIN};
+        std::atomic<std::uint64_t> top{empty_key};
+
+        void refresh() {
+            top.store(queue.count() ? queue.top_priority() : empty_key,
+                    std::memory_order_relaxed);
+        }
+    };
+
+    PriorityQueueType type;
+    std::size_t lanes_;
+    std::unique_ptr<unsigned char[]> storage;
+    Lane* lane;
+
+    std::atomic<std::size_t> count_{0};
+
+    std::uint32_t key(std::uint32_t priority) const;
+    bool pop_from(Lane& l, T& element);
+
+    static std::size_t random(std::size_t n);
+};
+
+template <class T>
+constexpr std::uint64_t MultiQueue<T>::empty_key;
+
+template <class T>
+constexpr std::size_t MultiQueue<T>::cache_line;
+
+template <class T>
+constexpr std::size_t MultiQueue<T>::max_attempts;
+
+template <class T>
+MultiQueue<T>::MultiQueue(PriorityQueueType type, std::size_t threads,
+        std::size_t factor) :
+        type{type},
+        lanes_{std::max<std::size_t>(threads * factor, 1)},
+        storage{new unsigned char[lanes_ * sizeof(Lane) + alignof(Lane)]} {
+
+    void* p = storage.get();
+    std::size_t space = lanes_ * sizeof(Lane) + alignof(Lane);
+
+    lane = static_cast<Lane*>(std::align(alignof(Lane),
+            lanes_ * sizeof(Lane), p, space));
+
+    std::size_t i = 0;
+
+    try {
+        for ( ; i < lanes_; ++i) {
+            ::new (static_cast<void*>(&lane[i])) Lane;
+        }
+    } catch (...) {
+        while (i--) {
+            lane[i].~Lane();
+        }
+        throw;
+    }
+}
+
+template <class T>
+MultiQueue<T>::~MultiQueue() {
+    for (std::size_t i = 0; i < lanes_; ++i) {
+        lane[i].~Lane();
+    }
+}
+
+template <class T>
+void MultiQueue<T>::push(const T& element, std::uint32_t priority) {
+    std::uint32_t k = key(priority);
+
+    for (std::size_t attempt = 1; ; ++attempt) {
+        Lane& l = lane[random(lanes_)];
+        std::unique_lock<std::mutex> guard(l.lock, std::defer_lock);
+
+        if (attempt == max_attempts) {
+            guard.lock();
+        } else if (!guard.try_lock()) {
+            if (attempt > max_attempts / 2) {
+                std::this_thread::yield();
+            }
+
+            continue;
+        }
+
+        l.queue.insert(element, k);
+        l.refresh();
+
+        count_.fetch_add(1, std::memory_order_relaxed);
+
+        return;
+    }
+}
+
+template <class T>
+bool MultiQueue<T>::try_pop(T& element) {
+    if (lanes_ > 1) {
+        for (std::size_t attempt = 0; attempt < lanes_; ++attempt) {
+            Lane& a = lane[random(lanes_)];
+            Lane& b = lane[random(lanes_)];
+
+            std::uint64_t a_top = a.top.load(std::memory_order_relaxed);
+            std::uint64_t b_top = b.top.load(std::memory_order_relaxed);
+
+            Lane& best = (b_top < a_top) ? b : a;
+
+            if (std::min(a_top, b_top) == empty_key) {
+                continue;
+            }
+
+            std::unique_lock<std::mutex> guard(best.lock, std::try_to_lock);
+
+            if (guard.owns_lock() && pop_from(best, element)) {
+                return true;
+            }
+        }
+    }
+
+    std::size_t start = random(lanes_);
+
+    for (std::size_t i = 0; i < lanes_; ++i) {
+        Lane& l = lane[(start + i) % lanes_];
+        std::lock_guard<std::mutex> guard(l.lock);
+
+        if (pop_from(l, element)) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+template <class T>
+std::size_t MultiQueue<T>::count() const {
+    return count_.load(std::memory_order_relaxed);
+}
+
+template <class T>
+std::size_t MultiQueue<T>::lanes() const {
+    return lanes_;
+}
+
+template <class T>
+std::uint32_t MultiQueue<T>::key(std::uint32_t priority) const {
+    return (type == PriorityQueueType::MIN) ? priority :
+            std::numeric_limits<std::uint32_t>::max() - priority;
+}
+
+template <class T>
+bool MultiQueue<T>::pop_from(Lane& l, T& element) {
+    if (!l.queue.count()) {
+        return false;
+    }
+
+    element = l.queue.pop();
+    l.refresh();
+
+    count_.fetch_sub(1, std::memory_order_relaxed);
+
+    return true;
+}
+
+template <class T>
+std::size_t MultiQueue<T>::random(std::size_t n) {
+    static thread_local std::uint64_t state = [] {
+        std::random_device rd;
+
+        return (std::uint64_t{rd()} << 32) | rd() | 1;
+    }();
+
+    state ^= state >> 12;
+    state ^= state << 25;
+    state ^= state >> 27;
+
+    return ((state * 0x2545F4914F6CDD1DULL) >> 32) % n;
+}
+
+}
+}
+
+#endif
@@ -0,0 +1,448 @@
+#ifndef ALG_DS_PAIRING_HEAP_H_
+#define ALG_DS_PAIRING_HEAP_H_
+
+#include <cstddef>
+#include <cstdint>
+
+#include <algorithm>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "alg/common/exception.h"
+#include "alg/common/node_pool.h"
+#include "alg/data_structure/priority_queue.h"
+
+namespace alg {
+namespace ds {
+
+template <class T>
+class PairingHeap {
+    class Node;
+
+public:
+    class Handle {
+    public:
+        Handle() = default;
+
+        bool operator==(const Handle& rhs) const {
+            return node == rhs.node && generation == rhs.generation;
+        }
+
+        bool operator!=(const Handle& rhs) const {
+            return !(*this == rhs);
+        }
+
+    private:
+        Node* node{nullptr};
+        std::size_t generation{0};
+
+        Handle(Node* node, std::size_t generation) :
+            node{node}, generation{generation} {}
+
+        friend class PairingHeap<T>;
+    };
+
+    explicit PairingHeap(PriorityQueueType type);
+
+    PairingHeap(const PairingHeap<T>&) = delete;
+    PairingHeap<T>& operator=(const PairingHeap<T>&) = delete;
+
+    ~PairingHeap();
+
+    T top();
+    T pop();
+
+    Handle insert(const T& element, std::uint32_t priority);
+    void update_priority(Handle handle, std::uint32_t new_priority);
+    void erase(Handle handle);
+    bool contains(Handle handle) const;
+
+    void meld(PairingHeap<T>& rhs);
+
+    std::uint32_t priority(Handle handle) const;
+
+    std::size_t count() const;
+
+private:
+    using allocator_type = std::allocator<T>;
+
+    class Owner {
+    public:
+        Owner* parent{nullptr};
+    };
+
+    class Node {
+    public:
+        typename std::aligned_storage<sizeof(T), alignof(T)>::type storage;
+        std::uint32_t priority{0};
+
+        Node* child{nullptr};
+        Node* sibling{nullptr};
+        Node* prev{nullptr};
+
+        Owner* owner{nullptr};
+        std::size_t generation{0};
+
+        T& element() {
+            return *reinterpret_cast<T*>(&storage);
+        }
+    };
+
+    PriorityQueueType type;
+    allocator_type alloc;
+
+    memory::NodePool<Node> pool;
+    memory::NodePool<Owner> owners;
+
+    Owner* owner_{nullptr};
+    Node* free_head{nullptr};
+    Node* free_tail{nullptr};
+
+    Node* root{nullptr};
+    std::size_t count_{0};
+
+    bool before(std::uint32_t lhs, std::uint32_t rhs) const;
+
+    Node* node_of(Handle handle) const;
+    Owner* current_owner();
+    static Owner* find(Owner* owner);
+
+    template <class... Args>
+    Node* acquire(std::uint32_t priority, Args&&... args);
+    void release(Node* node);
+
+    Node* link(Node* a, Node* b);
+    Node* combine(Node* first);
+    void cut(Node* node);
+    void remove_root();
+};
+
+template <class T>
+PairingHeap<T>::PairingHeap(PriorityQueueType type) : type{type} {
+}
+
+template <class T>
+PairingHeap<T>::~PairingHeap() {
+    Node* node = root;
+
+    while (node) {
+        if (node->child) {
+            Node* child = node->child;
+
+            node->child = child->sibling;
+            child->sibling = node;
+            node = child;
+        } else {
+            Node* next = node->sibling;
+
+            std::allocator_traits<allocator_type>::destroy(alloc,
+                    &node->element());
+            node = next;
+        }
+    }
+}
+
+template <class T>
+T PairingHeap<T>::top() {
+    if (!root) {
+        throw except::BufferEmpty();
+    }
+
+    return root->element();
+}
+
+template <class T>
+T PairingHeap<T>::pop() {
+    if (!root) {
+        throw except::BufferEmpty();
+    }
+
+    T element = std::move(root->element());
+    remove_root();
+
+    return element;
+}
+
+template <class T>
+typename PairingHeap<T>::Handle PairingHeap<T>::insert(const T& element,
+        std::uint32_t priority) {
+
+    Node* node = acquire(priority, element);
+
+    root = link(root, node);
+    ++count_;
+
+    return Handle(node, node->generation);
+}
+
+template <class T>
+void PairingHeap<T>::update_priority(Handle handle,
+        std::uint32_t new_priority) {
+
+    Node* node = node_of(handle);
+    std::uint32_t old_priority = node->priority;
+
+    node->priority = new_priority;
+
+    if (before(new_priority, old_priority)) {
+        if (node != root) {
+            cut(node);
+            root = link(root, node);
+        }
+
+        return;
+    }
+
+    Node* children = combine(node->child);
+    node->child = nullptr;
+
+    if (node == root) {
+        root = link(node, children);
+    } else {
+        cut(node);
+        root = link(root, link(node, children));
+    }
+}
+
+template <class T>
+void PairingHeap<T>::erase(Handle handle) {
+    Node* node = node_of(handle);
+
+    if (node == root) {
+        remove_root();
+        return;
+    }
+
+    cut(node);
+    root = link(root, combine(node->child));
+
+    release(node);
+    --count_;
+}
+
+template <class T>
+bool PairingHeap<T>::contains(Handle handle) const {
+    return handle.node && handle.node->generation == handle.generation &&
+            owner_ && find(handle.node->owner) == owner_;
+}
+
+template <class T>
+void PairingHeap<T>::meld(PairingHeap<T>& rhs) {
+    if (this == &rhs) {
+        return;
+    }
+
+    if (type != rhs.type) {
+        throw std::invalid_argument("Heap types differ");
+    }
+
+    Owner* owner = current_owner();
+
+    if (rhs.owner_) {
+        rhs.owner_->parent = owner;
+        rhs.owner_ = nullptr;
+    }
+
+    if (rhs.free_head) {
+        if (free_tail) {
+            free_tail->sibling = rhs.free_head;
+        } else {
+            free_head = rhs.free_head;
+        }
+        free_tail = rhs.free_tail;
+    }
+
+    root = link(root, rhs.root);
+    count_ += rhs.count_;
+    pool.splice(rhs.pool);
+    owners.splice(rhs.owners);
+
+    rhs.free_head = rhs.free_tail = nullptr;
+    rhs.root = nullptr;
+    rhs.count_ = 0;
+}
+
+template <class T>
+std::uint32_t PairingHeap<T>::priority(Handle handle) const {
+    return node_of(handle)->priority;
+}
+
+template <class T>
+std::size_t PairingHeap<T>::count() const {
+    return count_;
+}
+
+template <class T>
+bool PairingHeap<T>::before(std::uint32_t lhs, std::uint32_t rhs) const {
+    return (type == PriorityQueueType::MIN) ? lhs < rhs : lhs > rhs;
+}
+
+template <class T>
+typename PairingHeap<T>::Node* PairingHeap<T>::node_of(Handle handle) const {
+    if (!contains(handle)) {
+        throw except::ItemNotFound();
+    }
+
+    return handle.node;
+}
+
+template <class T>
+typename PairingHeap<T>::Owner* PairingHeap<T>::current_owner() {
+    if (!owner_) {
+        owner_ = owners.create();
+    }
+
+    return owner_;
+}
+
+template <class T>
+typename PairingHeap<T>::Owner* PairingHeap<T>::find(Owner* owner) {
+    while (owner->parent) {
+        if (owner->parent->parent) {
+            owner->parent = owner->parent->parent;
+        }
+
+        owner = owner->parent;
+    }
+
+    return owner;
+}
+
+template <class T>
+template <class... Args>
+typename PairingHeap<T>::Node* PairingHeap<T>::acquire(std::uint32_t priority,
+        Args&&... args) {
+
+    Owner* owner = current_owner();
+
+    if (!free_head) {
+        free_head = free_tail = pool.create();
+    }
+
+    Node* node = free_head;
+
+    std::allocator_traits<allocator_type>::construct(alloc,
+            &node->element(), std::forward<Args>(args)...);
+
+    free_head = node->sibling;
+
+    if (!free_head) {
+        free_tail = nullptr;
+    }
+
+    node->priority = priority;
+    node->child = node->sibling = node->prev = nullptr;
+    node->owner = owner;
+
+    return node;
+}
+
+template <class T>
+void PairingHeap<T>::release(Node* node) {
+    std::allocator_traits<allocator_type>::destroy(alloc, &node->element());
+
+    ++node->generation;
+    node->sibling = nullptr;
+
+    if (free_tail) {
+        free_tail->sibling = node;
+    } else {
+        free_head = node;
+    }
+    free_tail = node;
+}
+
+template <class T>
+typename PairingHeap<T>::Node* PairingHeap<T>::link(Node* a, Node* b) {
+    if (!a) {
+        return b;
+    }
+    if (!b) {
+        return a;
+    }
+
+    if (before(b->priority, a->priority)) {
+        std::swap(a, b);
+    }
+
+    b->prev = a;
+    b->sibling = a->child;
+
+    if (a->child) {
+        a->child->prev = b;
+    }
+
+    a->child = b;
+    a->sibling = nullptr;
+    a->prev = nullptr;
+
+    return a;
+}
+
+template <class T>
+typename PairingHeap<T>::Node* PairingHeap<T>::combine(Node* first) {
+    Node* paired = nullptr;
+
+    while (first) {
+        Node* a = first;
+        Node* b = a->sibling;
+
+        if (!b) {
+            a->prev = nullptr;
+            a->sibling = paired;
+            paired = a;
+            break;
+        }
+
+        first = b->sibling;
+
+        Node* merged = link(a, b);
+        merged->sibling = paired;
+        paired = merged;
+    }
+
+    Node* result = nullptr;
+
+    while (paired) {
+        Node* next = paired->sibling;
+
+        paired->sibling = nullptr;
+        result = link(result, paired);
+        paired = next;
+    }
+
+    return result;
+}
+
+template <class T>
+void PairingHeap<T>::cut(Node* node) {
+    if (node->prev->child == node) {
+        node->prev->child = node->sibling;
+    } else {
+        node->prev->sibling = node->sibling;
+    }
+
+    if (node->sibling) {
+        node->sibling->prev = node->prev;
+    }
+
+    node->sibling = nullptr;
+    node->prev = nullptr;
+}
+
+template <class T>
+void PairingHeap<T>::remove_root() {
+    Node* old_root = root;
+
+    root = combine(root->child);
+
+    release(old_root);
+    --count_;
+}
+
+}
+}
+
+#endif
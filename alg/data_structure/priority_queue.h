@@ -6,6 +6,7 @@
 
 #include <algorithm>
 #include <limits>
+#include <utility>
 
 #include "alg/common/exception.h"
 #include "alg/data_structure/binary_heap.h"
@@ -22,13 +23,55 @@ enum class PriorityQueueType {
 template <class T>
 class PriorityQueue {
 public:
+    class Handle {
+    public:
+        Handle() = default;
+
+        bool operator==(const Handle& rhs) const {
+            return id == rhs.id && generation == rhs.generation;
+        }
+
+        bool operator!=(const Handle& rhs) const {
+            return !(*this == rhs);
+        }
+
+    private:
+        std::size_t id{std::numeric_limits<std::size_t>::max()};
+        std::size_t generation{0};
+
+        Handle(std::size_t id, std::size_t generation) :
+            id{id}, generation{generation} {}
+
+        friend class PriorityQueue<T>;
+    };
+
     explicit PriorityQueue(PriorityQueueType type);
 
-    T top();
+    template <class InputIt>
+    PriorityQueue(PriorityQueueType type, InputIt first, InputIt last);
+
+    T& top();
+    const T& top() const;
     T pop();
 
-    void insert(const T& element, std::uint32_t priority);
+    std::uint32_t top_priority() const;
+
+    Handle insert(const T& element, std::uint32_t priority);
+    Handle insert(T&& element, std::uint32_t priority);
+
+    template <class... Args>
+    Handle emplace(std::uint32_t priority, Args&&... args);
+
+    template <class InputIt>
+    void insert_bulk(InputIt first, InputIt last);
+
     void update_priority(std::size_t index, std::uint32_t new_priority);
+    void update_priority(Handle handle, std::uint32_t new_priority);
+
+    void erase(Handle handle);
+    bool contains(Handle handle) const;
+
+    std::uint32_t priority(Handle handle) const;
 
     std::size_t count() const;
 
@@ -37,9 +80,13 @@ private:
     public:
         T element;
         std::uint32_t priority;
+        std::size_t handle;
 
-        PQData(const T& element, std::uint32_t priority) :
-            element{element}, priority{priority} {}
+        template <class... Args>
+        PQData(std::uint32_t priority, std::size_t handle, Args&&... args) :
+            element(std::forward<Args>(args)...),
+            priority{priority},
+            handle{handle} {}
 
         bool operator<(const PQData& rhs) const {
             return priority < rhs.priority;
@@ -50,27 +97,68 @@ private:
         }
     };
 
+    class Slot {
+    public:
+        std::size_t index;
+        std::size_t generation;
+
+        Slot(std::size_t index = npos, std::size_t generation = 0) :
+            index{index}, generation{generation} {}
+    };
+
+    static constexpr std::size_t npos = std::numeric_limits<std::size_t>::max();
+
     PriorityQueueType type;
     ExtendableArray<PQData> buffer;
+    ExtendableArray<Slot> slots;
+    ExtendableArray<std::size_t> free_handles;
     std::size_t count_;
 
+    std::size_t acquire_handle();
+    std::size_t index_of(Handle handle) const;
+
+    bool before(std::uint32_t lhs, std::uint32_t rhs) const;
+    heap::binary::Type heap_type() const;
+
+    void swap_data(std::size_t i, std::size_t j);
+    void remove_at(std::size_t index);
+
+    std::size_t sift_up(std::size_t index);
+    std::size_t sift_down(std::size_t index);
+
     void increase_priority(std::size_t index, std::uint32_t new_priority);
     void decrease_priority(std::size_t index, std::uint32_t new_priority);
 };
 
+template <class T>
+constexpr std::size_t PriorityQueue<T>::npos;
+
 template <class T>
 PriorityQueue<T>::PriorityQueue(PriorityQueueType type)
     : type{type},
       count_{0} {
 }
 
+template <class T>
+template <class InputIt>
+PriorityQueue<T>::PriorityQueue(PriorityQueueType type, InputIt first,
+        InputIt last) : PriorityQueue(type) {
+
+    insert_bulk(first, last);
+}
+
 template <class T>
 std::size_t PriorityQueue<T>::count() const {
     return count_;
 }
 
 template <class T>
-T PriorityQueue<T>::top() {
+T& PriorityQueue<T>::top() {
+    return const_cast<T&>(static_cast<const PriorityQueue<T>*>(this)->top());
+}
+
+template <class T>
+const T& PriorityQueue<T>::top() const {
     if (!count_) {
         throw except::BufferEmpty();
     }
@@ -84,34 +172,79 @@ T PriorityQueue<T>::pop() {
         throw except::BufferEmpty();
     }
 
-    T element = buffer[0].element;
-    buffer[0] = buffer[count_ - 1];
-    --count_;
+    T element = std::move(buffer[0].element);
+    remove_at(0);
 
-    heap::binary::Type heap_type = (type == PriorityQueueType::MIN) ?
-            heap::binary::Type::MIN : heap::binary::Type::MAX;
+    return element;
+}
+
+template <class T>
+std::uint32_t PriorityQueue<T>::top_priority() const {
+    if (!count_) {
+        throw except::BufferEmpty();
+    }
 
-    heap::binary::heapify(buffer.data_ptr(), 0, count_, heap_type);
+    return buffer[0].priority;
+}
 
-    return element;
+template <class T>
+typename PriorityQueue<T>::Handle PriorityQueue<T>::insert(const T& element,
+        std::uint32_t priority) {
+
+    return emplace(priority, element);
 }
 
 template <class T>
-void PriorityQueue<T>::insert(const T& element, std::uint32_t priority) {
-	std::uint32_t default_priotiry = (type == PriorityQueueType::MAX) ?
-            std::numeric_limits<std::uint32_t>::min() :
-            std::numeric_limits<std::uint32_t>::max();
+typename PriorityQueue<T>::Handle PriorityQueue<T>::insert(T&& element,
+        std::uint32_t priority) {
 
-    PQData data(element, default_priotiry);
+    return emplace(priority, std::move(element));
+}
+
+template <class T>
+template <class... Args>
+typename PriorityQueue<T>::Handle PriorityQueue<T>::emplace(
+        std::uint32_t priority, Args&&... args) {
+
+    std::size_t handle = acquire_handle();
+
+    buffer.emplace_back(priority, handle, std::forward<Args>(args)...);
     ++count_;
 
-    if (count_ <= buffer.count()) {
-        buffer[count_ - 1] = data;
-    } else {
-        buffer.add(count_ - 1, data);
+    slots[handle].index = count_ - 1;
+    sift_up(count_ - 1);
+
+    return Handle(handle, slots[handle].generation);
+}
+
+template <class T>
+template <class InputIt>
+void PriorityQueue<T>::insert_bulk(InputIt first, InputIt last) {
+    std::size_t old_count = count_;
+
+    for ( ; first != last; ++first) {
+        auto&& item = *first;
+        std::size_t handle = acquire_handle();
+
+        buffer.emplace_back(item.second, handle,
+                std::forward<decltype(item)>(item).first);
+
+        slots[handle].index = count_++;
+    }
+
+    if (count_ - old_count <= old_count) {
+        for (std::size_t i = old_count; i < count_; ++i) {
+            sift_up(i);
+        }
+
+        return;
     }
 
-    update_priority(count_ - 1, priority);
+    heap::binary::build_heap(buffer.data_ptr(), count_, heap_type());
+
+    for (std::size_t i = 0; i < count_; ++i) {
+        slots[buffer[i].handle].index = i;
+    }
 }
 
 template <class T>
@@ -126,47 +259,168 @@ void PriorityQueue<T>::update_priority(std::size_t index,
 }
 
 template <class T>
-void PriorityQueue<T>::increase_priority(std::size_t index,
-		std::uint32_t new_priority) {
+void PriorityQueue<T>::update_priority(Handle handle,
+        std::uint32_t new_priority) {
 
-    if (new_priority <= buffer[index].priority) {
+    std::size_t index = index_of(handle);
+    std::uint32_t old_priority = buffer[index].priority;
+
+    buffer[index].priority = new_priority;
+
+    if (before(new_priority, old_priority)) {
+        sift_up(index);
+    } else {
+        sift_down(index);
+    }
+}
+
+template <class T>
+void PriorityQueue<T>::erase(Handle handle) {
+    remove_at(index_of(handle));
+}
+
+template <class T>
+bool PriorityQueue<T>::contains(Handle handle) const {
+    return handle.id < slots.count() && slots[handle.id].index != npos &&
+            slots[handle.id].generation == handle.generation;
+}
+
+template <class T>
+std::uint32_t PriorityQueue<T>::priority(Handle handle) const {
+    return buffer[index_of(handle)].priority;
+}
+
+template <class T>
+std::size_t PriorityQueue<T>::acquire_handle() {
+    if (free_handles.count()) {
+        std::size_t handle = free_handles[free_handles.count() - 1];
+        free_handles.remove(free_handles.count() - 1);
+
+        return handle;
+    }
+
+    slots.append(Slot());
+
+    return slots.count() - 1;
+}
+
+template <class T>
+std::size_t PriorityQueue<T>::index_of(Handle handle) const {
+    if (!contains(handle)) {
+        throw except::ItemNotFound();
+    }
+
+    return slots[handle.id].index;
+}
+
+template <class T>
+bool PriorityQueue<T>::before(std::uint32_t lhs, std::uint32_t rhs) const {
+    return (type == PriorityQueueType::MIN) ? lhs < rhs : lhs > rhs;
+}
+
+template <class T>
+heap::binary::Type PriorityQueue<T>::heap_type() const {
+    return (type == PriorityQueueType::MIN) ?
+            heap::binary::Type::MIN : heap::binary::Type::MAX;
+}
+
+template <class T>
+void PriorityQueue<T>::swap_data(std::size_t i, std::size_t j) {
+    std::swap(buffer[i], buffer[j]);
+
+    slots[buffer[i].handle].index = i;
+    slots[buffer[j].handle].index = j;
+}
+
+template <class T>
+void PriorityQueue<T>::remove_at(std::size_t index) {
+    Slot& slot = slots[buffer[index].handle];
+
+    slot.index = npos;
+    ++slot.generation;
+    free_handles.append(buffer[index].handle);
+
+    --count_;
+
+    if (index == count_) {
+        buffer.remove(count_);
         return;
     }
 
-    buffer[index].priority = new_priority;
+    buffer[index] = std::move(buffer[count_]);
+    buffer.remove(count_);
+    slots[buffer[index].handle].index = index;
+
+    if (sift_up(index) == index) {
+        sift_down(index);
+    }
+}
 
+template <class T>
+std::size_t PriorityQueue<T>::sift_up(std::size_t index) {
     while (index > 0) {
-        int parent = heap::binary::parent(index);
+        std::size_t parent = heap::binary::parent(index);
 
-        if (buffer[index].priority <= buffer[parent].priority) {
+        if (!before(buffer[index].priority, buffer[parent].priority)) {
             break;
         }
 
-        std::swap(buffer[index], buffer[parent]);
+        swap_data(index, parent);
         index = parent;
     }
+
+    return index;
 }
 
 template <class T>
-void PriorityQueue<T>::decrease_priority(std::size_t index,
+std::size_t PriorityQueue<T>::sift_down(std::size_t index) {
+    while (true) {
+        std::size_t left = heap::binary::left(index);
+        std::size_t right = heap::binary::right(index);
+        std::size_t first = index;
+
+        if (left < count_ &&
+                before(buffer[left].priority, buffer[first].priority)) {
+            first = left;
+        }
+        if (right < count_ &&
+                before(buffer[right].priority, buffer[first].priority)) {
+            first = right;
+        }
+
+        if (first == index) {
+            break;
+        }
+
+        swap_data(index, first);
+        index = first;
+    }
+
+    return index;
+}
+
+template <class T>
+void PriorityQueue<T>::increase_priority(std::size_t index,
 		std::uint32_t new_priority) {
 
-    if (new_priority >= buffer[index].priority) {
+    if (new_priority <= buffer[index].priority) {
         return;
     }
 
     buffer[index].priority = new_priority;
+    sift_up(index);
+}
 
-    while (index > 0) {
-        int parent = heap::binary::parent(index);
-
-        if (buffer[index].priority >= buffer[parent].priority) {
-            break;
-        }
+template <class T>
+void PriorityQueue<T>::decrease_priority(std::size_t index,
+		std::uint32_t new_priority) {
 
-        std::swap(buffer[index], buffer[parent]);
-        index = parent;
+    if (new_priority >= buffer[index].priority) {
+        return;
     }
+
+    buffer[index].priority = new_priority;
+    sift_up(index);
 }
 
 }
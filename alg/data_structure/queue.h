@@ -3,6 +3,8 @@
 
 #include <cstddef>
 
+#include <utility>
+
 #include "alg/common/exception.h"
 
 namespace alg {
@@ -15,6 +17,7 @@ public:
     ~Queue();
 
     void enqueue(const T& element);
+    void enqueue(T&& element);
     T dequeue();
     std::size_t count() const;
 
@@ -45,13 +48,23 @@ void Queue<T>::enqueue(const T& element) {
     rear = (rear + 1) % size;
 }
 
+template <class T>
+void Queue<T>::enqueue(T&& element) {
+    if ((rear + 1) % size == front) {
+        throw except::BufferFull();
+    }
+
+    buffer[rear] = std::move(element);
+    rear = (rear + 1) % size;
+}
+
 template <class T>
 T Queue<T>::dequeue() {
     if (front == rear) {
         throw except::BufferEmpty();
     }
 
-    T element = buffer[front];
+    T element = std::move(buffer[front]);
     front = (front + 1) % size;
 
     return element;
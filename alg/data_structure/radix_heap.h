@@ -0,0 +1,170 @@
+#ifndef ALG_DS_RADIX_HEAP_H_
+#define ALG_DS_RADIX_HEAP_H_
+
+#include <cstddef>
+#include <cstdint>
+
+#include <stdexcept>
+#include <utility>
+
+#include "alg/common/exception.h"
+#include "alg/data_structure/extendable_array.h"
+
+namespace alg {
+namespace ds {
+
+template <class T>
+class RadixHeap {
+public:
+    T& top();
+    T pop();
+
+    std::uint32_t top_priority();
+
+    void insert(const T& element, std::uint32_t priority);
+    void insert(T&& element, std::uint32_t priority);
+
+    template <class... Args>
+    void emplace(std::uint32_t priority, Args&&... args);
+
+    std::size_t count() const;
+
+private:
+    class RHData {
+    public:
+        T element;
+        std::uint32_t priority;
+
+        template <class... Args>
+        RHData(std::uint32_t priority, Args&&... args) :
+            element(std::forward<Args>(args)...),
+            priority{priority} {}
+    };
+
+    static constexpr std::size_t bucket_count = 33;
+
+    ExtendableArray<RHData> buckets[bucket_count];
+    std::uint32_t last{0};
+    std::size_t count_{0};
+
+    std::size_t bucket_of(std::uint32_t priority) const;
+    void redistribute();
+};
+
+template <class T>
+constexpr std::size_t RadixHeap<T>::bucket_count;
+
+template <class T>
+T& RadixHeap<T>::top() {
+    redistribute();
+
+    return buckets[0][buckets[0].count() - 1].element;
+}
+
+template <class T>
+T RadixHeap<T>::pop() {
+    redistribute();
+
+    std::size_t index = buckets[0].count() - 1;
+    T element = std::move(buckets[0][index].element);
+
+    buckets[0].remove(index);
+    --count_;
+
+    return element;
+}
+
+template <class T>
+std::uint32_t RadixHeap<T>::top_priority() {
+    redistribute();
+
+    return last;
+}
+
+template <class T>
+void RadixHeap<T>::insert(const T& element, std::uint32_t priority) {
+    emplace(priority, element);
+}
+
+template <class T>
+void RadixHeap<T>::insert(T&& element, std::uint32_t priority) {
+    emplace(priority, std::move(element));
+}
+
+template <class T>
+template <class... Args>
+void RadixHeap<T>::emplace(std::uint32_t priority, Args&&... args) {
+    if (priority < last) {
+        throw std::invalid_argument("Priority is less than last extracted");
+    }
+
+    buckets[bucket_of(priority)].emplace_back(priority,
+            std::forward<Args>(args)...);
+    ++count_;
+}
+
+template <class T>
+std::size_t RadixHeap<T>::count() const {
+    return count_;
+}
+
+template <class T>
+std::size_t RadixHeap<T>::bucket_of(std::uint32_t priority) const {
+    std::uint32_t diff = priority ^ last;
+
+    if (!diff) {
+        return 0;
+    }
+
+#if defined(__GNUC__)
+    return 32 - __builtin_clz(diff);
+#else
+    std::size_t bucket = 0;
+
+    for ( ; diff; diff >>= 1) {
+        ++bucket;
+    }
+
+    return bucket;
+#endif
+}
+
+template <class T>
+void RadixHeap<T>::redistribute() {
+    if (!count_) {
+        throw except::BufferEmpty();
+    }
+
+    if (buckets[0].count()) {
+        return;
+    }
+
+    std::size_t i = 1;
+
+    while (!buckets[i].count()) {
+        ++i;
+    }
+
+    ExtendableArray<RHData>& bucket = buckets[i];
+    std::uint32_t min = bucket[0].priority;
+
+    for (std::size_t j = 1; j < bucket.count(); ++j) {
+        if (bucket[j].priority < min) {
+            min = bucket[j].priority;
+        }
+    }
+
+    last = min;
+
+    for (std::size_t j = 0; j < bucket.count(); ++j) {
+        buckets[bucket_of(bucket[j].priority)].emplace_back(
+                std::move(bucket[j]));
+    }
+
+    bucket.clear();
+}
+
+}
+}
+
+#endif
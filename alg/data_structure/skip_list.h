@@ -0,0 +1,491 @@
+#ifndef ALG_DS_SKIP_LIST_H_
+#define ALG_DS_SKIP_LIST_H_
+
+#include <cstddef>
+#include <cstdint>
+
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#include "alg/common/exception.h"
+#include "alg/common/randomizer.h"
+#include "alg/data_structure/extendable_array.h"
+
+namespace alg {
+namespace ds {
+
+template <class T, class Compare = std::less<T>>
+class SkipList {
+    class Node;
+    class Iter;
+
+public:
+    using iterator = Iter;
+    using const_iterator = Iter;
+
+    static constexpr std::size_t max_level = 16;
+
+    explicit SkipList(const Compare& comp = Compare());
+
+    template <class InputIt>
+    SkipList(InputIt first, InputIt last, const Compare& comp = Compare());
+
+    SkipList(const SkipList<T, Compare>&) = delete;
+    SkipList<T, Compare>& operator=(const SkipList<T, Compare>&) = delete;
+
+    ~SkipList();
+
+    bool insert(const T& element);
+    bool insert(T&& element);
+
+    bool erase(const T& element);
+
+    bool contains(const T& element) const;
+    iterator find(const T& element) const;
+
+    iterator lower_bound(const T& element) const;
+    iterator upper_bound(const T& element) const;
+
+    const T& min() const;
+    const T& max() const;
+
+    std::size_t count() const;
+    std::size_t levels() const;
+
+    void clear();
+
+    iterator begin() const;
+    iterator end() const;
+
+private:
+    using allocator_type = std::allocator<T>;
+
+    static constexpr std::size_t block_size = 16384;
+
+    class Node {
+    public:
+        typename std::aligned_storage<sizeof(T), alignof(T)>::type storage;
+        std::size_t height;
+        Node* next[1];
+
+        T& element() {
+            return *reinterpret_cast<T*>(&storage);
+        }
+    };
+
+    class Iter {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const T*;
+        using reference = const T&;
+
+        Iter() = default;
+
+        reference operator*() const {
+            return node->element();
+        }
+
+        pointer operator->() const {
+            return &node->element();
+        }
+
+        Iter& operator++() {
+            node = node->next[0];
+            return *this;
+        }
+
+        Iter operator++(int) {
+            Iter old = *this;
+            node = node->next[0];
+            return old;
+        }
+
+        bool operator==(const Iter& rhs) const {
+            return node == rhs.node;
+        }
+
+        bool operator!=(const Iter& rhs) const {
+            return node != rhs.node;
+        }
+
+    private:
+        Node* node{nullptr};
+
+        explicit Iter(Node* node) : node{node} {}
+
+        friend class SkipList<T, Compare>;
+    };
+
+    static_assert(alignof(Node) <= alignof(std::max_align_t),
+            "SkipList arena blocks are only max_align_t aligned");
+
+    allocator_type alloc;
+    Compare comp;
+
+    ExtendableArray<unsigned char*> blocks;
+    unsigned char* cursor{nullptr};
+    std::size_t remaining{0};
+    Node* free_nodes[max_level] = {};
+
+    Node* head;
+    Node* finger[max_level];
+
+    std::size_t levels_{1};
+    std::size_t count_{0};
+
+    static std::size_t node_size(std::size_t height);
+    static std::size_t random_height();
+
+    Node* allocate(std::size_t height);
+    void deallocate(Node* node);
+
+    template <class U>
+    bool emplace(U&& element);
+
+    Node* seek(const T& element);
+    Node* search(const T& element) const;
+    bool equal(const T& lhs, const T& rhs) const;
+};
+
+template <class T, class Compare>
+constexpr std::size_t SkipList<T, Compare>::max_level;
+
+template <class T, class Compare>
+constexpr std::size_t SkipList<T, Compare>::block_size;
+
+template <class T, class Compare>
+SkipList<T, Compare>::SkipList(const Compare& comp) :
+        comp(comp), head{allocate(max_level)} {
+
+    for (std::size_t i = 0; i < max_level; ++i) {
+        head->next[i] = nullptr;
+        finger[i] = head;
+    }
+}
+
+template <class T, class Compare>
+template <class InputIt>
+SkipList<T, Compare>::SkipList(InputIt first, InputIt last,
+        const Compare& comp) : SkipList(comp) {
+
+    for ( ; first != last; ++first) {
+        insert(*first);
+    }
+}
+
+template <class T, class Compare>
+SkipList<T, Compare>::~SkipList() {
+    clear();
+
+    for (std::size_t i = 0; i < blocks.count(); ++i) {
+        delete[] blocks[i];
+    }
+}
+
+template <class T, class Compare>
+bool SkipList<T, Compare>::insert(const T& element) {
+    return emplace(element);
+}
+
+template <class T, class Compare>
+bool SkipList<T, Compare>::insert(T&& element) {
+    return emplace(std::move(element));
+}
+
+template <class T, class Compare>
+bool SkipList<T, Compare>::erase(const T& element) {
+    Node* x = seek(element);
+
+    if (!x || !equal(element, x->element())) {
+        return false;
+    }
+
+    for (std::size_t i = 0; i < x->height; ++i) {
+        finger[i]->next[i] = x->next[i];
+    }
+
+    deallocate(x);
+    --count_;
+
+    return true;
+}
+
+template <class T, class Compare>
+bool SkipList<T, Compare>::contains(const T& element) const {
+    return find(element) != end();
+}
+
+template <class T, class Compare>
+typename SkipList<T, Compare>::iterator SkipList<T, Compare>::find(
+        const T& element) const {
+
+    Node* x = search(element);
+
+    return iterator((x && equal(element, x->element())) ? x : nullptr);
+}
+
+template <class T, class Compare>
+typename SkipList<T, Compare>::iterator SkipList<T, Compare>::lower_bound(
+        const T& element) const {
+
+    return iterator(search(element));
+}
+
+template <class T, class Compare>
+typename SkipList<T, Compare>::iterator SkipList<T, Compare>::upper_bound(
+        const T& element) const {
+
+    Node* x = search(element);
+
+    if (x && !comp(element, x->element())) {
+        x = x->next[0];
+    }
+
+    return iterator(x);
+}
+
+template <class T, class Compare>
+const T& SkipList<T, Compare>::min() const {
+    if (!count_) {
+        throw except::BufferEmpty();
+    }
+
+    return head->next[0]->element();
+}
+
+template <class T, class Compare>
+const T& SkipList<T, Compare>::max() const {
+    if (!count_) {
+        throw except::BufferEmpty();
+    }
+
+    Node* x = head;
+
+    for (std::size_t i = levels_; i-- > 0; ) {
+        while (x->next[i]) {
+            x = x->next[i];
+        }
+    }
+
+    return x->element();
+}
+
+template <class T, class Compare>
+std::size_t SkipList<T, Compare>::count() const {
+    return count_;
+}
+
+template <class T, class Compare>
+std::size_t SkipList<T, Compare>::levels() const {
+    return levels_;
+}
+
+template <class T, class Compare>
+void SkipList<T, Compare>::clear() {
+    Node* x = head->next[0];
+
+    while (x) {
+        Node* next = x->next[0];
+
+        deallocate(x);
+        x = next;
+    }
+
+    for (std::size_t i = 0; i < max_level; ++i) {
+        head->next[i] = nullptr;
+        finger[i] = head;
+    }
+
+    levels_ = 1;
+    count_ = 0;
+}
+
+template <class T, class Compare>
+typename SkipList<T, Compare>::iterator SkipList<T, Compare>::begin() const {
+    return iterator(head->next[0]);
+}
+
+template <class T, class Compare>
+typename SkipList<T, Compare>::iterator SkipList<T, Compare>::end() const {
+    return iterator(nullptr);
+}
+
+template <class T, class Compare>
+std::size_t SkipList<T, Compare>::node_size(std::size_t height) {
+    std::size_t size = sizeof(Node) + (height - 1) * sizeof(Node*);
+
+    return (size + alignof(Node) - 1) / alignof(Node) * alignof(Node);
+}
+
+template <class T, class Compare>
+std::size_t SkipList<T, Compare>::random_height() {
+    std::uint32_t bits = static_cast<std::uint32_t>(randomizer::engine()());
+    std::size_t height = 1;
+
+    while (height < max_level && !(bits & 3)) {
+        ++height;
+        bits >>= 2;
+    }
+
+    return height;
+}
+
+template <class T, class Compare>
+typename SkipList<T, Compare>::Node* SkipList<T, Compare>::allocate(
+        std::size_t height) {
+
+    Node* node = free_nodes[height - 1];
+
+    if (node) {
+        free_nodes[height - 1] = node->next[0];
+        return node;
+    }
+
+    std::size_t size = node_size(height);
+
+    if (remaining < size) {
+        std::size_t n = (size > block_size) ? size : block_size;
+
+        cursor = new unsigned char[n];
+        remaining = n;
+
+        blocks.append(cursor);
+    }
+
+    node = ::new (static_cast<void*>(cursor)) Node;
+    node->height = height;
+
+    cursor += size;
+    remaining -= size;
+
+    return node;
+}
+
+template <class T, class Compare>
+void SkipList<T, Compare>::deallocate(Node* node) {
+    std::allocator_traits<allocator_type>::destroy(alloc, &node->element());
+
+    node->next[0] = free_nodes[node->height - 1];
+    free_nodes[node->height - 1] = node;
+}
+
+template <class T, class Compare>
+template <class U>
+bool SkipList<T, Compare>::emplace(U&& element) {
+    Node* x = seek(element);
+
+    if (x && equal(element, x->element())) {
+        return false;
+    }
+
+    std::size_t height = random_height();
+    Node* node = allocate(height);
+
+    try {
+        std::allocator_traits<allocator_type>::construct(alloc,
+                &node->element(), std::forward<U>(element));
+    } catch (...) {
+        node->next[0] = free_nodes[height - 1];
+        free_nodes[height - 1] = node;
+        throw;
+    }
+
+    if (height > levels_) {
+        levels_ = height;
+    }
+
+    for (std::size_t i = 0; i < height; ++i) {
+        node->next[i] = finger[i]->next[i];
+        finger[i]->next[i] = node;
+    }
+
+    ++count_;
+
+    return true;
+}
+
+template <class T, class Compare>
+typename SkipList<T, Compare>::Node* SkipList<T, Compare>::seek(
+        const T& element) {
+
+    std::size_t level = 0;
+    Node* x;
+
+    if (finger[0] == head || comp(finger[0]->element(), element)) {
+        while (level + 1 < levels_) {
+            Node* next = finger[level + 1]->next[level + 1];
+
+            if (!next || !comp(next->element(), element)) {
+                break;
+            }
+
+            ++level;
+        }
+
+        x = finger[level];
+    } else {
+        while (level < levels_ && finger[level] != head &&
+                !comp(finger[level]->element(), element)) {
+            ++level;
+        }
+
+        if (level == levels_) {
+            x = head;
+            --level;
+        } else {
+            x = finger[level];
+        }
+    }
+
+    Node* bound = nullptr;
+
+    for (std::size_t i = level + 1; i-- > 0; ) {
+        Node* next = x->next[i];
+
+        while (next != bound && comp(next->element(), element)) {
+            x = next;
+            next = x->next[i];
+        }
+
+        bound = next;
+        finger[i] = x;
+    }
+
+    return bound;
+}
+
+template <class T, class Compare>
+typename SkipList<T, Compare>::Node* SkipList<T, Compare>::search(
+        const T& element) const {
+
+    Node* x = head;
+    Node* bound = nullptr;
+
+    for (std::size_t i = levels_; i-- > 0; ) {
+        Node* next = x->next[i];
+
+        while (next != bound && comp(next->element(), element)) {
+            x = next;
+            next = x->next[i];
+        }
+
+        bound = next;
+    }
+
+    return bound;
+}
+
+template <class T, class Compare>
+bool SkipList<T, Compare>::equal(const T& lhs, const T& rhs) const {
+    return !comp(lhs, rhs) && !comp(rhs, lhs);
+}
+
+}
+}
+
+#endif
@@ -0,0 +1,295 @@
+#ifndef ALG_DS_SMALL_STACK_H_
+#define ALG_DS_SMALL_STACK_H_
+
+#include <cstddef>
+
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#include "alg/common/exception.h"
+#include "alg/common/utils.h"
+
+namespace alg {
+namespace ds {
+
+template <class T, std::size_t N = 16>
+class SmallStack {
+    static_assert(N > 0, "SmallStack needs at least one inline slot");
+
+public:
+    using allocator_type = std::allocator<T>;
+
+    SmallStack();
+
+    SmallStack(const SmallStack<T, N>& rhs);
+    SmallStack(SmallStack<T, N>&& rhs) noexcept;
+
+    ~SmallStack();
+
+    void push(const T& element);
+    void push(T&& element);
+
+    template <class... Args>
+    void emplace(Args&&... args);
+
+    void pop();
+
+    T& top();
+    const T& top() const;
+
+    std::size_t count() const;
+    std::size_t capacity() const;
+
+    bool is_inline() const;
+
+    void reserve(std::size_t new_capacity);
+    void clear();
+
+    SmallStack<T, N>& operator=(const SmallStack<T, N>& rhs) &;
+    SmallStack<T, N>& operator=(SmallStack<T, N>&& rhs) & noexcept;
+
+private:
+    allocator_type alloc;
+
+    typename std::aligned_storage<sizeof(T), alignof(T)>::type storage[N];
+
+    T* buffer;
+    std::size_t capacity_{N};
+    std::size_t top_{0};
+
+    T* inline_buffer();
+    void relocate(T* tmp_buffer, std::size_t new_capacity);
+    void release();
+};
+
+template <class T, std::size_t N>
+SmallStack<T, N>::SmallStack() : buffer{inline_buffer()} {
+}
+
+template <class T, std::size_t N>
+SmallStack<T, N>::SmallStack(const SmallStack<T, N>& rhs) : SmallStack() {
+    reserve(rhs.top_);
+
+    for ( ; top_ < rhs.top_; ++top_) {
+        std::allocator_traits<allocator_type>::construct(alloc,
+                &buffer[top_], rhs.buffer[top_]);
+    }
+}
+
+template <class T, std::size_t N>
+SmallStack<T, N>::SmallStack(SmallStack<T, N>&& rhs) noexcept : SmallStack() {
+    *this = std::move(rhs);
+}
+
+template <class T, std::size_t N>
+SmallStack<T, N>::~SmallStack() {
+    clear();
+    release();
+}
+
+template <class T, std::size_t N>
+void SmallStack<T, N>::push(const T& element) {
+    emplace(element);
+}
+
+template <class T, std::size_t N>
+void SmallStack<T, N>::push(T&& element) {
+    emplace(std::move(element));
+}
+
+template <class T, std::size_t N>
+template <class... Args>
+void SmallStack<T, N>::emplace(Args&&... args) {
+    if (top_ < capacity_) {
+        std::allocator_traits<allocator_type>::construct(alloc,
+                &buffer[top_], std::forward<Args>(args)...);
+
+        ++top_;
+        return;
+    }
+
+    std::size_t new_capacity = 2 * capacity_;
+    T* tmp_buffer = std::allocator_traits<allocator_type>::allocate(alloc,
+            new_capacity);
+
+    try {
+        std::allocator_traits<allocator_type>::construct(alloc,
+                &tmp_buffer[top_], std::forward<Args>(args)...);
+    } catch (...) {
+        std::allocator_traits<allocator_type>::deallocate(alloc, tmp_buffer,
+                new_capacity);
+        throw;
+    }
+
+    try {
+        relocate(tmp_buffer, new_capacity);
+    } catch (...) {
+        std::allocator_traits<allocator_type>::destroy(alloc,
+                &tmp_buffer[top_]);
+        std::allocator_traits<allocator_type>::deallocate(alloc, tmp_buffer,
+                new_capacity);
+        throw;
+    }
+
+    ++top_;
+}
+
+template <class T, std::size_t N>
+void SmallStack<T, N>::pop() {
+    if (!top_) {
+        throw except::BufferEmpty();
+    }
+
+    std::allocator_traits<allocator_type>::destroy(alloc, &buffer[--top_]);
+}
+
+template <class T, std::size_t N>
+T& SmallStack<T, N>::top() {
+    return const_cast<T&>(static_cast<const SmallStack<T, N>*>(this)->top());
+}
+
+template <class T, std::size_t N>
+const T& SmallStack<T, N>::top() const {
+    if (!top_) {
+        throw except::BufferEmpty();
+    }
+
+    return buffer[top_ - 1];
+}
+
+template <class T, std::size_t N>
+std::size_t SmallStack<T, N>::count() const {
+    return top_;
+}
+
+template <class T, std::size_t N>
+std::size_t SmallStack<T, N>::capacity() const {
+    return capacity_;
+}
+
+template <class T, std::size_t N>
+bool SmallStack<T, N>::is_inline() const {
+    return capacity_ == N;
+}
+
+template <class T, std::size_t N>
+void SmallStack<T, N>::reserve(std::size_t new_capacity) {
+    if (new_capacity <= capacity_) {
+        return;
+    }
+
+    T* tmp_buffer = std::allocator_traits<allocator_type>::allocate(alloc,
+            new_capacity);
+
+    try {
+        relocate(tmp_buffer, new_capacity);
+    } catch (...) {
+        std::allocator_traits<allocator_type>::deallocate(alloc, tmp_buffer,
+                new_capacity);
+        throw;
+    }
+}
+
+template <class T, std::size_t N>
+void SmallStack<T, N>::clear() {
+    utils::clear_buffer(buffer, alloc, 0, top_, capacity_, false);
+
+    top_ = 0;
+}
+
+template <class T, std::size_t N>
+SmallStack<T, N>& SmallStack<T, N>::operator=(const SmallStack<T, N>& rhs) & {
+    if (this == &rhs) {
+        return *this;
+    }
+
+    clear();
+    reserve(rhs.top_);
+
+    for ( ; top_ < rhs.top_; ++top_) {
+        std::allocator_traits<allocator_type>::construct(alloc,
+                &buffer[top_], rhs.buffer[top_]);
+    }
+
+    return *this;
+}
+
+template <class T, std::size_t N>
+SmallStack<T, N>& SmallStack<T, N>::operator=(
+        SmallStack<T, N>&& rhs) & noexcept {
+
+    if (this == &rhs) {
+        return *this;
+    }
+
+    clear();
+
+    if (!rhs.is_inline()) {
+        release();
+
+        buffer = rhs.buffer;
+        capacity_ = rhs.capacity_;
+        top_ = rhs.top_;
+
+        rhs.buffer = rhs.inline_buffer();
+        rhs.capacity_ = N;
+        rhs.top_ = 0;
+
+        return *this;
+    }
+
+    for ( ; top_ < rhs.top_; ++top_) {
+        std::allocator_traits<allocator_type>::construct(alloc,
+                &buffer[top_], std::move(rhs.buffer[top_]));
+    }
+
+    rhs.clear();
+
+    return *this;
+}
+
+template <class T, std::size_t N>
+T* SmallStack<T, N>::inline_buffer() {
+    return reinterpret_cast<T*>(storage);
+}
+
+template <class T, std::size_t N>
+void SmallStack<T, N>::relocate(T* tmp_buffer, std::size_t new_capacity) {
+    std::size_t i = 0;
+
+    try {
+        for ( ; i < top_; ++i) {
+            std::allocator_traits<allocator_type>::construct(alloc,
+                    &tmp_buffer[i], std::move_if_noexcept(buffer[i]));
+        }
+    } catch (...) {
+        while (i--) {
+            std::allocator_traits<allocator_type>::destroy(alloc,
+                    &tmp_buffer[i]);
+        }
+        throw;
+    }
+
+    utils::clear_buffer(buffer, alloc, 0, top_, capacity_, false);
+    release();
+
+    buffer = tmp_buffer;
+    capacity_ = new_capacity;
+}
+
+template <class T, std::size_t N>
+void SmallStack<T, N>::release() {
+    if (!is_inline()) {
+        std::allocator_traits<allocator_type>::deallocate(alloc, buffer,
+                capacity_);
+
+        buffer = inline_buffer();
+        capacity_ = N;
+    }
+}
+
+}
+}
+
+#endif
@@ -0,0 +1,443 @@
+#ifndef ALG_DS_SPLIT_PRIORITY_QUEUE_H_
+#define ALG_DS_SPLIT_PRIORITY_QUEUE_H_
+
+#include <cstddef>
+#include <cstdint>
+
+#include <limits>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#include "alg/common/exception.h"
+#include "alg/data_structure/binary_heap.h"
+#include "alg/data_structure/extendable_array.h"
+#include "alg/data_structure/priority_queue.h"
+
+namespace alg {
+namespace ds {
+
+template <class T>
+class SplitPriorityQueue {
+public:
+    class Handle {
+    public:
+        Handle() = default;
+
+        bool operator==(const Handle& rhs) const {
+            return id == rhs.id && generation == rhs.generation;
+        }
+
+        bool operator!=(const Handle& rhs) const {
+            return !(*this == rhs);
+        }
+
+    private:
+        std::size_t id{std::numeric_limits<std::size_t>::max()};
+        std::size_t generation{0};
+
+        Handle(std::size_t id, std::size_t generation) :
+            id{id}, generation{generation} {}
+
+        friend class SplitPriorityQueue<T>;
+    };
+
+    explicit SplitPriorityQueue(PriorityQueueType type);
+
+    template <class InputIt>
+    SplitPriorityQueue(PriorityQueueType type, InputIt first, InputIt last);
+
+    T& top();
+    const T& top() const;
+    T pop();
+
+    std::uint32_t top_priority() const;
+
+    Handle insert(const T& element, std::uint32_t priority);
+    Handle insert(T&& element, std::uint32_t priority);
+
+    template <class... Args>
+    Handle emplace(std::uint32_t priority, Args&&... args);
+
+    template <class InputIt>
+    void insert_bulk(InputIt first, InputIt last);
+
+    void update_priority(Handle handle, std::uint32_t new_priority);
+
+    void erase(Handle handle);
+    bool contains(Handle handle) const;
+
+    std::uint32_t priority(Handle handle) const;
+
+    std::size_t count() const;
+
+private:
+    using allocator_type = std::allocator<T>;
+
+    static constexpr std::size_t npos = std::numeric_limits<std::size_t>::max();
+
+    class Slot {
+    public:
+        typename std::aligned_storage<sizeof(T), alignof(T)>::type storage;
+
+        std::size_t index{npos};
+        std::size_t generation{0};
+
+        template <class... Args>
+        explicit Slot(std::size_t index, Args&&... args) : index{index} {
+            allocator_type alloc;
+            std::allocator_traits<allocator_type>::construct(alloc,
+                    &element(), std::forward<Args>(args)...);
+        }
+
+        Slot(const Slot&) = delete;
+        Slot& operator=(const Slot&) = delete;
+
+        Slot(Slot&& rhs) noexcept(
+                std::is_nothrow_move_constructible<T>::value) :
+            index{rhs.index},
+            generation{rhs.generation} {
+
+            if (index != npos) {
+                allocator_type alloc;
+                std::allocator_traits<allocator_type>::construct(alloc,
+                        &element(), std::move(rhs.element()));
+            }
+        }
+
+        ~Slot() {
+            if (index != npos) {
+                allocator_type alloc;
+                std::allocator_traits<allocator_type>::destroy(alloc,
+                        &element());
+            }
+        }
+
+        T& element() {
+            return *reinterpret_cast<T*>(&storage);
+        }
+
+        const T& element() const {
+            return *reinterpret_cast<const T*>(&storage);
+        }
+    };
+
+    PriorityQueueType type;
+    allocator_type alloc;
+
+    ExtendableArray<std::uint32_t> keys;
+    ExtendableArray<std::size_t> ids;
+
+    ExtendableArray<Slot> slots;
+    ExtendableArray<std::size_t> free_ids;
+
+    template <class... Args>
+    std::size_t acquire(std::uint32_t priority, Args&&... args);
+    std::size_t index_of(Handle handle) const;
+
+    bool before(std::uint32_t lhs, std::uint32_t rhs) const;
+    void remove_at(std::size_t index);
+    T take(std::size_t index);
+
+    std::size_t sift_up(std::size_t index);
+    std::size_t sift_down(std::size_t index);
+};
+
+template <class T>
+constexpr std::size_t SplitPriorityQueue<T>::npos;
+
+template <class T>
+SplitPriorityQueue<T>::SplitPriorityQueue(PriorityQueueType type) :
+        type{type} {
+}
+
+template <class T>
+template <class InputIt>
+SplitPriorityQueue<T>::SplitPriorityQueue(PriorityQueueType type,
+        InputIt first, InputIt last) : SplitPriorityQueue(type) {
+
+    insert_bulk(first, last);
+}
+
+template <class T>
+T& SplitPriorityQueue<T>::top() {
+    return const_cast<T&>(
+            static_cast<const SplitPriorityQueue<T>*>(this)->top());
+}
+
+template <class T>
+const T& SplitPriorityQueue<T>::top() const {
+    if (!keys.count()) {
+        throw except::BufferEmpty();
+    }
+
+    return slots[ids[0]].element();
+}
+
+template <class T>
+T SplitPriorityQueue<T>::pop() {
+    if (!keys.count()) {
+        throw except::BufferEmpty();
+    }
+
+    return take(0);
+}
+
+template <class T>
+std::uint32_t SplitPriorityQueue<T>::top_priority() const {
+    if (!keys.count()) {
+        throw except::BufferEmpty();
+    }
+
+    return keys[0];
+}
+
+template <class T>
+typename SplitPriorityQueue<T>::Handle SplitPriorityQueue<T>::insert(
+        const T& element, std::uint32_t priority) {
+
+    return emplace(priority, element);
+}
+
+template <class T>
+typename SplitPriorityQueue<T>::Handle SplitPriorityQueue<T>::insert(
+        T&& element, std::uint32_t priority) {
+
+    return emplace(priority, std::move(element));
+}
+
+template <class T>
+template <class... Args>
+typename SplitPriorityQueue<T>::Handle SplitPriorityQueue<T>::emplace(
+        std::uint32_t priority, Args&&... args) {
+
+    std::size_t id = acquire(priority, std::forward<Args>(args)...);
+
+    sift_up(slots[id].index);
+
+    return Handle(id, slots[id].generation);
+}
+
+template <class T>
+template <class InputIt>
+void SplitPriorityQueue<T>::insert_bulk(InputIt first, InputIt last) {
+    std::size_t old_count = keys.count();
+
+    for ( ; first != last; ++first) {
+        auto&& item = *first;
+
+        acquire(item.second, std::forward<decltype(item)>(item).first);
+    }
+
+    std::size_t count = keys.count();
+
+    if (count - old_count <= old_count) {
+        for (std::size_t i = old_count; i < count; ++i) {
+            sift_up(i);
+        }
+
+        return;
+    }
+
+    for (int i = heap::binary::parent(count - 1); i >= 0; --i) {
+        sift_down(i);
+    }
+}
+
+template <class T>
+void SplitPriorityQueue<T>::update_priority(Handle handle,
+        std::uint32_t new_priority) {
+
+    std::size_t index = index_of(handle);
+    std::uint32_t old_priority = keys[index];
+
+    keys[index] = new_priority;
+
+    if (before(new_priority, old_priority)) {
+        sift_up(index);
+    } else {
+        sift_down(index);
+    }
+}
+
+template <class T>
+void SplitPriorityQueue<T>::erase(Handle handle) {
+    take(index_of(handle));
+}
+
+template <class T>
+bool SplitPriorityQueue<T>::contains(Handle handle) const {
+    return handle.id < slots.count() && slots[handle.id].index != npos &&
+            slots[handle.id].generation == handle.generation;
+}
+
+template <class T>
+std::uint32_t SplitPriorityQueue<T>::priority(Handle handle) const {
+    return keys[index_of(handle)];
+}
+
+template <class T>
+std::size_t SplitPriorityQueue<T>::count() const {
+    return keys.count();
+}
+
+template <class T>
+template <class... Args>
+std::size_t SplitPriorityQueue<T>::acquire(std::uint32_t priority,
+        Args&&... args) {
+
+    std::size_t index = keys.count();
+    std::size_t id;
+
+    keys.append(priority);
+
+    try {
+        ids.append(npos);
+
+        if (free_ids.count()) {
+            id = free_ids[free_ids.count() - 1];
+
+            std::allocator_traits<allocator_type>::construct(alloc,
+                    &slots[id].element(), std::forward<Args>(args)...);
+            slots[id].index = index;
+            free_ids.remove(free_ids.count() - 1);
+        } else {
+            slots.emplace_back(index, std::forward<Args>(args)...);
+            id = slots.count() - 1;
+        }
+    } catch (...) {
+        if (ids.count() > index) {
+            ids.remove(index);
+        }
+
+        keys.remove(index);
+        throw;
+    }
+
+    ids[index] = id;
+
+    return id;
+}
+
+template <class T>
+std::size_t SplitPriorityQueue<T>::index_of(Handle handle) const {
+    if (!contains(handle)) {
+        throw except::ItemNotFound();
+    }
+
+    return slots[handle.id].index;
+}
+
+template <class T>
+bool SplitPriorityQueue<T>::before(std::uint32_t lhs, std::uint32_t rhs) const {
+    return (type == PriorityQueueType::MIN) ? lhs < rhs : lhs > rhs;
+}
+
+template <class T>
+void SplitPriorityQueue<T>::remove_at(std::size_t index) {
+    std::size_t last = keys.count() - 1;
+    Slot& slot = slots[ids[index]];
+
+    free_ids.append(ids[index]);
+    slot.index = npos;
+    ++slot.generation;
+
+    if (index != last) {
+        keys[index] = keys[last];
+        ids[index] = ids[last];
+        slots[ids[index]].index = index;
+    }
+
+    keys.remove(last);
+    ids.remove(last);
+
+    if (index != last && sift_up(index) == index) {
+        sift_down(index);
+    }
+}
+
+template <class T>
+T SplitPriorityQueue<T>::take(std::size_t index) {
+    std::size_t id = ids[index];
+    T element = std::move(slots[id].element());
+
+    remove_at(index);
+    std::allocator_traits<allocator_type>::destroy(alloc,
+            &slots[id].element());
+
+    return element;
+}
+
+template <class T>
+std::size_t SplitPriorityQueue<T>::sift_up(std::size_t index) {
+    std::uint32_t* key = keys.data_ptr();
+    std::size_t* id = ids.data_ptr();
+    Slot* slot = slots.data_ptr();
+
+    std::uint32_t hole_key = key[index];
+    std::size_t hole_id = id[index];
+
+    while (index > 0) {
+        std::size_t parent = heap::binary::parent(index);
+
+        if (!before(hole_key, key[parent])) {
+            break;
+        }
+
+        key[index] = key[parent];
+        id[index] = id[parent];
+        slot[id[index]].index = index;
+
+        index = parent;
+    }
+
+    key[index] = hole_key;
+    id[index] = hole_id;
+    slot[hole_id].index = index;
+
+    return index;
+}
+
+template <class T>
+std::size_t SplitPriorityQueue<T>::sift_down(std::size_t index) {
+    std::uint32_t* key = keys.data_ptr();
+    std::size_t* id = ids.data_ptr();
+    Slot* slot = slots.data_ptr();
+    std::size_t count = keys.count();
+
+    std::uint32_t hole_key = key[index];
+    std::size_t hole_id = id[index];
+
+    while (true) {
+        std::size_t child = heap::binary::left(index);
+
+        if (child >= count) {
+            break;
+        }
+
+        if (child + 1 < count && before(key[child + 1], key[child])) {
+            ++child;
+        }
+
+        if (!before(key[child], hole_key)) {
+            break;
+        }
+
+        key[index] = key[child];
+        id[index] = id[child];
+        slot[id[index]].index = index;
+
+        index = child;
+    }
+
+    key[index] = hole_key;
+    id[index] = hole_id;
+    slot[hole_id].index = index;
+
+    return index;
+}
+
+}
+}
+
+#endif
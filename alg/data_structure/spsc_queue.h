@@ -0,0 +1,241 @@
+#ifndef ALG_DS_SPSC_QUEUE_H_
+#define ALG_DS_SPSC_QUEUE_H_
+
+#include <cstddef>
+
+#include <atomic>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+
+namespace alg {
+namespace ds {
+
+template <class T>
+class SpscQueue {
+public:
+    using allocator_type = std::allocator<T>;
+
+    explicit SpscQueue(std::size_t n);
+
+    SpscQueue(const SpscQueue<T>&) = delete;
+    SpscQueue<T>& operator=(const SpscQueue<T>&) = delete;
+
+    ~SpscQueue();
+
+    bool try_push(const T& element);
+    bool try_push(T&& element);
+
+    template <class... Args>
+    bool try_emplace(Args&&... args);
+
+    bool try_pop(T& element);
+
+    template <class InputIt>
+    std::size_t push_bulk(InputIt first, InputIt last);
+
+    template <class OutputIt>
+    std::size_t pop_bulk(OutputIt out, std::size_t n);
+
+    std::size_t count() const;
+    std::size_t capacity() const;
+
+private:
+    static constexpr std::size_t cache_line = 64;
+
+    allocator_type alloc;
+
+    std::size_t capacity_;
+    std::size_t mask;
+    T* buffer;
+
+    char padding0[cache_line];
+
+    std::atomic<std::size_t> head{0};
+    std::size_t tail_cache{0};
+
+    char padding1[cache_line];
+
+    std::atomic<std::size_t> tail{0};
+    std::size_t head_cache{0};
+
+    char padding2[cache_line];
+
+    static std::size_t round_up(std::size_t n);
+};
+
+template <class T>
+constexpr std::size_t SpscQueue<T>::cache_line;
+
+template <class T>
+SpscQueue<T>::SpscQueue(std::size_t n) :
+        capacity_{round_up(n)},
+        mask{capacity_ - 1},
+        buffer{std::allocator_traits<allocator_type>::allocate(alloc,
+                capacity_)} {
+}
+
+template <class T>
+SpscQueue<T>::~SpscQueue() {
+    std::size_t h = head.load(std::memory_order_relaxed);
+    std::size_t t = tail.load(std::memory_order_relaxed);
+
+    for ( ; h != t; ++h) {
+        std::allocator_traits<allocator_type>::destroy(alloc,
+                &buffer[h & mask]);
+    }
+
+    std::allocator_traits<allocator_type>::deallocate(alloc, buffer,
+            capacity_);
+}
+
+template <class T>
+bool SpscQueue<T>::try_push(const T& element) {
+    return try_emplace(element);
+}
+
+template <class T>
+bool SpscQueue<T>::try_push(T&& element) {
+    return try_emplace(std::move(element));
+}
+
+template <class T>
+template <class... Args>
+bool SpscQueue<T>::try_emplace(Args&&... args) {
+    std::size_t t = tail.load(std::memory_order_relaxed);
+
+    if (t - head_cache == capacity_) {
+        head_cache = head.load(std::memory_order_acquire);
+
+        if (t - head_cache == capacity_) {
+            return false;
+        }
+    }
+
+    std::allocator_traits<allocator_type>::construct(alloc, &buffer[t & mask],
+            std::forward<Args>(args)...);
+    tail.store(t + 1, std::memory_order_release);
+
+    return true;
+}
+
+template <class T>
+bool SpscQueue<T>::try_pop(T& element) {
+    std::size_t h = head.load(std::memory_order_relaxed);
+
+    if (h == tail_cache) {
+        tail_cache = tail.load(std::memory_order_acquire);
+
+        if (h == tail_cache) {
+            return false;
+        }
+    }
+
+    T& slot = buffer[h & mask];
+
+    element = std::move(slot);
+    std::allocator_traits<allocator_type>::destroy(alloc, &slot);
+    head.store(h + 1, std::memory_order_release);
+
+    return true;
+}
+
+template <class T>
+template <class InputIt>
+std::size_t SpscQueue<T>::push_bulk(InputIt first, InputIt last) {
+    std::size_t t = tail.load(std::memory_order_relaxed);
+    std::size_t free = capacity_ - (t - head_cache);
+    std::size_t pushed = 0;
+
+    try {
+        for ( ; first != last; ++first, ++pushed) {
+            if (pushed == free) {
+                head_cache = head.load(std::memory_order_acquire);
+                free = capacity_ - (t - head_cache);
+
+                if (pushed == free) {
+                    break;
+                }
+            }
+
+            std::allocator_traits<allocator_type>::construct(alloc,
+                    &buffer[(t + pushed) & mask], *first);
+        }
+    } catch (...) {
+        if (pushed) {
+            tail.store(t + pushed, std::memory_order_release);
+        }
+
+        throw;
+    }
+
+    if (pushed) {
+        tail.store(t + pushed, std::memory_order_release);
+    }
+
+    return pushed;
+}
+
+template <class T>
+template <class OutputIt>
+std::size_t SpscQueue<T>::pop_bulk(OutputIt out, std::size_t n) {
+    std::size_t h = head.load(std::memory_order_relaxed);
+
+    if (tail_cache - h < n) {
+        tail_cache = tail.load(std::memory_order_acquire);
+    }
+
+    std::size_t available = tail_cache - h;
+    std::size_t popped = 0;
+
+    for ( ; popped < n && popped < available; ++popped, ++out) {
+        T& slot = buffer[(h + popped) & mask];
+
+        *out = std::move(slot);
+        std::allocator_traits<allocator_type>::destroy(alloc, &slot);
+    }
+
+    if (popped) {
+        head.store(h + popped, std::memory_order_release);
+    }
+
+    return popped;
+}
+
+template <class T>
+std::size_t SpscQueue<T>::count() const {
+    std::size_t t = tail.load(std::memory_order_acquire);
+    std::size_t h = head.load(std::memory_order_acquire);
+
+    return (t - h <= capacity_) ? t - h : 0;
+}
+
+template <class T>
+std::size_t SpscQueue<T>::capacity() const {
+    return capacity_;
+}
+
+template <class T>
+std::size_t SpscQueue<T>::round_up(std::size_t n) {
+    if (!n) {
+        throw std::invalid_argument("Capacity must be positive");
+    }
+
+    if (n > (std::numeric_limits<std::size_t>::max() >> 1) + 1) {
+        throw std::invalid_argument("Capacity is too large");
+    }
+
+    std::size_t capacity = 1;
+
+    while (capacity < n) {
+        capacity <<= 1;
+    }
+
+    return capacity;
+}
+
+}
+}
+
+#endif
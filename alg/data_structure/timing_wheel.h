@@ -0,0 +1,373 @@
+#ifndef ALG_DS_TIMING_WHEEL_H_
+#define ALG_DS_TIMING_WHEEL_H_
+
+#include <cstddef>
+#include <cstdint>
+
+#include <limits>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#include "alg/common/exception.h"
+#include "alg/data_structure/extendable_array.h"
+
+namespace alg {
+namespace ds {
+
+template <class T>
+class TimingWheel {
+public:
+    class Handle {
+    public:
+        Handle() = default;
+
+        bool operator==(const Handle& rhs) const {
+            return id == rhs.id && generation == rhs.generation;
+        }
+
+        bool operator!=(const Handle& rhs) const {
+            return !(*this == rhs);
+        }
+
+    private:
+        std::size_t id{std::numeric_limits<std::size_t>::max()};
+        std::size_t generation{0};
+
+        Handle(std::size_t id, std::size_t generation) :
+            id{id}, generation{generation} {}
+
+        friend class TimingWheel<T>;
+    };
+
+    static constexpr std::uint32_t max_delay =
+            std::numeric_limits<std::int32_t>::max();
+
+    explicit TimingWheel(std::uint32_t now = 0);
+
+    Handle schedule(const T& element, std::uint32_t expires);
+    Handle schedule(T&& element, std::uint32_t expires);
+
+    void cancel(Handle handle);
+    bool contains(Handle handle) const;
+
+    std::uint32_t expires(Handle handle) const;
+
+    template <class F>
+    std::size_t advance(std::uint32_t now, F callback);
+
+    std::uint32_t now() const;
+    std::size_t count() const;
+
+private:
+    static constexpr std::size_t npos = std::numeric_limits<std::size_t>::max();
+
+    static constexpr std::size_t root_bits = 8;
+    static constexpr std::size_t level_bits = 6;
+    static constexpr std::size_t levels = 4;
+
+    static constexpr std::size_t root_size = std::size_t{1} << root_bits;
+    static constexpr std::size_t level_size = std::size_t{1} << level_bits;
+    static constexpr std::size_t bucket_count = root_size + levels * level_size;
+
+    using allocator_type = std::allocator<T>;
+
+    class Timer {
+    public:
+        typename std::aligned_storage<sizeof(T), alignof(T)>::type storage;
+        std::uint32_t expires{0};
+
+        std::size_t bucket{npos};
+        std::size_t prev{npos};
+        std::size_t next{npos};
+        std::size_t generation{0};
+
+        Timer() = default;
+
+        Timer(const Timer&) = delete;
+        Timer& operator=(const Timer&) = delete;
+
+        Timer(Timer&& rhs) noexcept(
+                std::is_nothrow_move_constructible<T>::value) :
+            expires{rhs.expires},
+            bucket{rhs.bucket},
+            prev{rhs.prev},
+            next{rhs.next},
+            generation{rhs.generation} {
+
+            if (bucket != npos) {
+                allocator_type alloc;
+                std::allocator_traits<allocator_type>::construct(alloc,
+                        &element(), std::move(rhs.element()));
+            }
+        }
+
+        ~Timer() {
+            if (bucket != npos) {
+                allocator_type alloc;
+                std::allocator_traits<allocator_type>::destroy(alloc,
+                        &element());
+            }
+        }
+
+        T& element() {
+            return *reinterpret_cast<T*>(&storage);
+        }
+    };
+
+    allocator_type alloc;
+
+    ExtendableArray<Timer> timers;
+    ExtendableArray<std::size_t> free_timers;
+
+    std::size_t heads[bucket_count];
+
+    std::uint32_t now_;
+    std::uint32_t current;
+    std::size_t count_{0};
+
+    template <class U>
+    Handle arm(U&& element, std::uint32_t expires);
+
+    std::size_t index_of(Handle handle) const;
+
+    void link(std::size_t id);
+    void unlink(std::size_t id);
+    void release(std::size_t id);
+
+    std::size_t cascade(std::size_t level);
+};
+
+template <class T>
+constexpr std::uint32_t TimingWheel<T>::max_delay;
+
+template <class T>
+constexpr std::size_t TimingWheel<T>::npos;
+
+template <class T>
+constexpr std::size_t TimingWheel<T>::root_bits;
+
+template <class T>
+constexpr std::size_t TimingWheel<T>::level_bits;
+
+template <class T>
+constexpr std::size_t TimingWheel<T>::levels;
+
+template <class T>
+constexpr std::size_t TimingWheel<T>::root_size;
+
+template <class T>
+constexpr std::size_t TimingWheel<T>::level_size;
+
+template <class T>
+constexpr std::size_t TimingWheel<T>::bucket_count;
+
+template <class T>
+TimingWheel<T>::TimingWheel(std::uint32_t now) : now_{now}, current{now + 1} {
+    for (std::size_t i = 0; i < bucket_count; ++i) {
+        heads[i] = npos;
+    }
+}
+
+template <class T>
+typename TimingWheel<T>::Handle TimingWheel<T>::schedule(const T& element,
+        std::uint32_t expires) {
+
+    return arm(element, expires);
+}
+
+template <class T>
+typename TimingWheel<T>::Handle TimingWheel<T>::schedule(T&& element,
+        std::uint32_t expires) {
+
+    return arm(std::move(element), expires);
+}
+
+template <class T>
+void TimingWheel<T>::cancel(Handle handle) {
+    std::size_t id = index_of(handle);
+
+    unlink(id);
+    release(id);
+}
+
+template <class T>
+bool TimingWheel<T>::contains(Handle handle) const {
+    return handle.id < timers.count() && timers[handle.id].bucket != npos &&
+            timers[handle.id].generation == handle.generation;
+}
+
+template <class T>
+std::uint32_t TimingWheel<T>::expires(Handle handle) const {
+    return timers[index_of(handle)].expires;
+}
+
+template <class T>
+template <class F>
+std::size_t TimingWheel<T>::advance(std::uint32_t now, F callback) {
+    std::size_t fired = 0;
+
+    while (static_cast<std::int32_t>(now - current) >= 0) {
+        if (!count_) {
+            current = now + 1;
+            break;
+        }
+
+        std::size_t index = current & (root_size - 1);
+
+        for (std::size_t level = 0; !index && level < levels; ++level) {
+            index = cascade(level);
+        }
+
+        std::size_t bucket = current & (root_size - 1);
+        now_ = current;
+
+        while (heads[bucket] != npos) {
+            std::size_t id = heads[bucket];
+            T element = std::move(timers[id].element());
+
+            unlink(id);
+            release(id);
+            callback(element);
+
+            ++fired;
+        }
+
+        ++current;
+    }
+
+    now_ = current - 1;
+
+    return fired;
+}
+
+template <class T>
+std::uint32_t TimingWheel<T>::now() const {
+    return now_;
+}
+
+template <class T>
+std::size_t TimingWheel<T>::count() const {
+    return count_;
+}
+
+template <class T>
+template <class U>
+typename TimingWheel<T>::Handle TimingWheel<T>::arm(U&& element,
+        std::uint32_t expires) {
+
+    if (!free_timers.count()) {
+        timers.emplace_back();
+        free_timers.append(timers.count() - 1);
+    }
+
+    std::size_t id = free_timers[free_timers.count() - 1];
+
+    std::allocator_traits<allocator_type>::construct(alloc,
+            &timers[id].element(), std::forward<U>(element));
+    free_timers.remove(free_timers.count() - 1);
+
+    timers[id].expires = expires;
+    link(id);
+    ++count_;
+
+    return Handle(id, timers[id].generation);
+}
+
+template <class T>
+std::size_t TimingWheel<T>::index_of(Handle handle) const {
+    if (!contains(handle)) {
+        throw except::ItemNotFound();
+    }
+
+    return handle.id;
+}
+
+template <class T>
+void TimingWheel<T>::link(std::size_t id) {
+    Timer& timer = timers[id];
+    std::uint32_t expires = timer.expires;
+    std::uint32_t delta = expires - current;
+    std::size_t bucket;
+
+    if (delta > max_delay) {
+        bucket = current & (root_size - 1);
+    } else if (delta < root_size) {
+        bucket = expires & (root_size - 1);
+    } else {
+        std::size_t level = 0;
+        std::size_t shift = root_bits;
+
+        while (level + 1 < levels &&
+                delta >= (std::uint64_t{1} << (shift + level_bits))) {
+            ++level;
+            shift += level_bits;
+        }
+
+        bucket = root_size + level * level_size +
+                ((expires >> shift) & (level_size - 1));
+    }
+
+    timer.bucket = bucket;
+    timer.prev = npos;
+    timer.next = heads[bucket];
+
+    if (heads[bucket] != npos) {
+        timers[heads[bucket]].prev = id;
+    }
+
+    heads[bucket] = id;
+}
+
+template <class T>
+void TimingWheel<T>::unlink(std::size_t id) {
+    Timer& timer = timers[id];
+
+    if (timer.prev != npos) {
+        timers[timer.prev].next = timer.next;
+    } else {
+        heads[timer.bucket] = timer.next;
+    }
+
+    if (timer.next != npos) {
+        timers[timer.next].prev = timer.prev;
+    }
+
+    timer.bucket = npos;
+    timer.prev = timer.next = npos;
+}
+
+template <class T>
+void TimingWheel<T>::release(std::size_t id) {
+    std::allocator_traits<allocator_type>::destroy(alloc,
+            &timers[id].element());
+
+    ++timers[id].generation;
+    free_timers.append(id);
+
+    --count_;
+}
+
+template <class T>
+std::size_t TimingWheel<T>::cascade(std::size_t level) {
+    std::size_t shift = root_bits + level * level_bits;
+    std::size_t index = (current >> shift) & (level_size - 1);
+    std::size_t bucket = root_size + level * level_size + index;
+    std::size_t id = heads[bucket];
+
+    heads[bucket] = npos;
+
+    while (id != npos) {
+        std::size_t next = timers[id].next;
+
+        link(id);
+        id = next;
+    }
+
+    return index;
+}
+
+}
+}
+
+#endif
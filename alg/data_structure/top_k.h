@@ -0,0 +1,189 @@
+#ifndef ALG_DS_TOP_K_H_
+#define ALG_DS_TOP_K_H_
+
+#include <cstddef>
+
+#include <algorithm>
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+
+#include "alg/common/exception.h"
+#include "alg/data_structure/binary_heap.h"
+#include "alg/data_structure/extendable_array.h"
+
+namespace alg {
+namespace ds {
+
+template <class T>
+class TopK {
+public:
+    explicit TopK(std::size_t k);
+
+    bool offer(const T& element);
+    bool offer(T&& element);
+
+    template <class InputIt>
+    std::size_t offer_bulk(InputIt first, InputIt last);
+
+    void merge(const TopK<T>& rhs);
+    void merge(TopK<T>&& rhs);
+
+    const T& min() const;
+    ExtendableArray<T> extract();
+
+    std::size_t k() const;
+    std::size_t count() const;
+
+private:
+    std::size_t k_;
+    ExtendableArray<T> heap_;
+
+    template <class U>
+    bool accept(U&& element);
+
+    void sift_up(std::size_t index);
+};
+
+template <class T>
+TopK<T>::TopK(std::size_t k) : k_{k} {
+    if (!k) {
+        throw std::invalid_argument("K must be positive");
+    }
+
+    heap_.reserve(k);
+}
+
+template <class T>
+bool TopK<T>::offer(const T& element) {
+    return accept(element);
+}
+
+template <class T>
+bool TopK<T>::offer(T&& element) {
+    return accept(std::move(element));
+}
+
+template <class T>
+template <class InputIt>
+std::size_t TopK<T>::offer_bulk(InputIt first, InputIt last) {
+    std::size_t accepted = 0;
+
+    for ( ; first != last && heap_.count() < k_; ++first) {
+        accepted += accept(*first);
+    }
+
+    T* a = heap_.data_ptr();
+    int n = static_cast<int>(k_);
+
+    for ( ; first != last; ++first) {
+        if (!(a[0] < *first)) {
+            continue;
+        }
+
+        a[0] = *first;
+        heap::binary::min_heapify(a, 0, n);
+
+        ++accepted;
+    }
+
+    return accepted;
+}
+
+template <class T>
+void TopK<T>::merge(const TopK<T>& rhs) {
+    if (this == &rhs) {
+        return;
+    }
+
+    const T* a = rhs.heap_.data_ptr();
+
+    offer_bulk(a, a + rhs.heap_.count());
+}
+
+template <class T>
+void TopK<T>::merge(TopK<T>&& rhs) {
+    if (this == &rhs) {
+        return;
+    }
+
+    T* a = rhs.heap_.data_ptr();
+
+    offer_bulk(std::make_move_iterator(a),
+            std::make_move_iterator(a + rhs.heap_.count()));
+    rhs.heap_.clear();
+}
+
+template <class T>
+const T& TopK<T>::min() const {
+    if (!heap_.count()) {
+        throw except::BufferEmpty();
+    }
+
+    return heap_[0];
+}
+
+template <class T>
+ExtendableArray<T> TopK<T>::extract() {
+    T* a = heap_.data_ptr();
+    int n = static_cast<int>(heap_.count());
+
+    while (n > 1) {
+        std::swap(a[0], a[n - 1]);
+        --n;
+        heap::binary::min_heapify(a, 0, n);
+    }
+
+    ExtendableArray<T> result(std::move(heap_));
+
+    heap_ = ExtendableArray<T>();
+    heap_.reserve(k_);
+
+    return result;
+}
+
+template <class T>
+std::size_t TopK<T>::k() const {
+    return k_;
+}
+
+template <class T>
+std::size_t TopK<T>::count() const {
+    return heap_.count();
+}
+
+template <class T>
+template <class U>
+bool TopK<T>::accept(U&& element) {
+    if (heap_.count() < k_) {
+        heap_.append(std::forward<U>(element));
+        sift_up(heap_.count() - 1);
+
+        return true;
+    }
+
+    if (!(heap_[0] < element)) {
+        return false;
+    }
+
+    heap_[0] = std::forward<U>(element);
+    heap::binary::min_heapify(heap_.data_ptr(), 0, static_cast<int>(k_));
+
+    return true;
+}
+
+template <class T>
+void TopK<T>::sift_up(std::size_t index) {
+    T* a = heap_.data_ptr();
+    int i = static_cast<int>(index);
+
+    while (i > 0 && a[i] < a[heap::binary::parent(i)]) {
+        std::swap(a[i], a[heap::binary::parent(i)]);
+        i = heap::binary::parent(i);
+    }
+}
+
+}
+}
+
+#endif
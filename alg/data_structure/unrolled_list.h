@@ -0,0 +1,548 @@
+#ifndef ALG_DS_LIST_UNROLLED_LIST_H_
+#define ALG_DS_LIST_UNROLLED_LIST_H_
+
+#include <cstddef>
+
+#include <algorithm>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#include "alg/common/exception.h"
+#include "alg/common/node_pool.h"
+
+namespace alg {
+namespace ds {
+namespace list {
+
+template <class T>
+constexpr std::size_t unrolled_node_capacity() {
+    return 256 / sizeof(T) < 8 ? 8 :
+            256 / sizeof(T) > 64 ? 64 : 256 / sizeof(T);
+}
+
+template <class T, std::size_t N = unrolled_node_capacity<T>()>
+class UnrolledList {
+    static_assert(N >= 2, "UnrolledList nodes need room for two elements");
+
+    class Node;
+
+    template <class U>
+    class Iter;
+
+public:
+    using iterator = Iter<T>;
+    using const_iterator = Iter<const T>;
+
+    UnrolledList() = default;
+
+    UnrolledList(const UnrolledList<T, N>&) = delete;
+    UnrolledList<T, N>& operator=(const UnrolledList<T, N>&) = delete;
+
+    ~UnrolledList();
+
+    void push_back(const T& element);
+    void push_back(T&& element);
+
+    void push_front(const T& element);
+    void push_front(T&& element);
+
+    void pop_back();
+    void pop_front();
+
+    T& front();
+    const T& front() const;
+
+    T& back();
+    const T& back() const;
+
+    iterator insert(iterator position, const T& element);
+    iterator insert(iterator position, T&& element);
+
+    iterator erase(iterator position);
+
+    iterator search(const T& element);
+    const_iterator search(const T& element) const;
+
+    std::size_t count() const;
+    void clear();
+
+    iterator begin();
+    iterator end();
+
+    const_iterator begin() const;
+    const_iterator end() const;
+
+private:
+    using allocator_type = std::allocator<T>;
+
+    class Node {
+    public:
+        Node* next{nullptr};
+        Node* prev{nullptr};
+        std::size_t count{0};
+
+        typename std::aligned_storage<sizeof(T), alignof(T)>::type storage[N];
+
+        T* data() {
+            return reinterpret_cast<T*>(storage);
+        }
+    };
+
+    template <class U>
+    class Iter {
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = U*;
+        using reference = U&;
+
+        Iter() = default;
+
+        template <class V, class = typename std::enable_if<
+                std::is_convertible<V*, U*>::value>::type>
+        Iter(const Iter<V>& rhs) :
+            list{rhs.list}, node{rhs.node}, index{rhs.index} {}
+
+        reference operator*() const {
+            return node->data()[index];
+        }
+
+        pointer operator->() const {
+            return &node->data()[index];
+        }
+
+        Iter& operator++() {
+            if (++index == node->count) {
+                node = node->next;
+                index = 0;
+            }
+
+            return *this;
+        }
+
+        Iter operator++(int) {
+            Iter old = *this;
+            ++*this;
+            return old;
+        }
+
+        Iter& operator--() {
+            if (!node) {
+                node = list->tail;
+                index = node->count - 1;
+            } else if (!index) {
+                node = node->prev;
+                index = node->count - 1;
+            } else {
+                --index;
+            }
+
+            return *this;
+        }
+
+        Iter operator--(int) {
+            Iter old = *this;
+            --*this;
+            return old;
+        }
+
+        bool operator==(const Iter& rhs) const {
+            return node == rhs.node && index == rhs.index;
+        }
+
+        bool operator!=(const Iter& rhs) const {
+            return !(*this == rhs);
+        }
+
+    private:
+        const UnrolledList<T, N>* list{nullptr};
+        Node* node{nullptr};
+        std::size_t index{0};
+
+        Iter(const UnrolledList<T, N>* list, Node* node, std::size_t index) :
+            list{list}, node{node}, index{index} {}
+
+        template <class V>
+        friend class Iter;
+
+        friend class UnrolledList<T, N>;
+    };
+
+    allocator_type alloc;
+    memory::NodePool<Node> pool;
+
+    Node* head{nullptr};
+    Node* tail{nullptr};
+    std::size_t count_{0};
+
+    Node* create_node(Node* prev);
+    void destroy_node(Node* node);
+
+    Node* split(Node* node);
+
+    template <class U>
+    iterator emplace_at(Node* node, std::size_t index, U&& element);
+
+    template <class U>
+    iterator insert_at(iterator position, U&& element);
+
+    iterator erase_at(Node* node, std::size_t index);
+};
+
+template <class T, std::size_t N>
+UnrolledList<T, N>::~UnrolledList() {
+    clear();
+}
+
+template <class T, std::size_t N>
+void UnrolledList<T, N>::push_back(const T& element) {
+    insert_at(end(), element);
+}
+
+template <class T, std::size_t N>
+void UnrolledList<T, N>::push_back(T&& element) {
+    insert_at(end(), std::move(element));
+}
+
+template <class T, std::size_t N>
+void UnrolledList<T, N>::push_front(const T& element) {
+    insert_at(begin(), element);
+}
+
+template <class T, std::size_t N>
+void UnrolledList<T, N>::push_front(T&& element) {
+    insert_at(begin(), std::move(element));
+}
+
+template <class T, std::size_t N>
+void UnrolledList<T, N>::pop_back() {
+    if (!count_) {
+        throw except::BufferEmpty();
+    }
+
+    erase_at(tail, tail->count - 1);
+}
+
+template <class T, std::size_t N>
+void UnrolledList<T, N>::pop_front() {
+    if (!count_) {
+        throw except::BufferEmpty();
+    }
+
+    erase_at(head, 0);
+}
+
+template <class T, std::size_t N>
+T& UnrolledList<T, N>::front() {
+    return const_cast<T&>(static_cast<const UnrolledList<T, N>*>(this)->front());
+}
+
+template <class T, std::size_t N>
+const T& UnrolledList<T, N>::front() const {
+    if (!count_) {
+        throw except::BufferEmpty();
+    }
+
+    return head->data()[0];
+}
+
+template <class T, std::size_t N>
+T& UnrolledList<T, N>::back() {
+    return const_cast<T&>(static_cast<const UnrolledList<T, N>*>(this)->back());
+}
+
+template <class T, std::size_t N>
+const T& UnrolledList<T, N>::back() const {
+    if (!count_) {
+        throw except::BufferEmpty();
+    }
+
+    return tail->data()[tail->count - 1];
+}
+
+template <class T, std::size_t N>
+typename UnrolledList<T, N>::iterator UnrolledList<T, N>::insert(
+        iterator position, const T& element) {
+
+    return insert_at(position, element);
+}
+
+template <class T, std::size_t N>
+typename UnrolledList<T, N>::iterator UnrolledList<T, N>::insert(
+        iterator position, T&& element) {
+
+    return insert_at(position, std::move(element));
+}
+
+template <class T, std::size_t N>
+typename UnrolledList<T, N>::iterator UnrolledList<T, N>::erase(
+        iterator position) {
+
+    return erase_at(position.node, position.index);
+}
+
+template <class T, std::size_t N>
+typename UnrolledList<T, N>::iterator UnrolledList<T, N>::search(
+        const T& element) {
+
+    const_iterator it = static_cast<const UnrolledList<T, N>*>(this)->search(
+            element);
+
+    return iterator(this, it.node, it.index);
+}
+
+template <class T, std::size_t N>
+typename UnrolledList<T, N>::const_iterator UnrolledList<T, N>::search(
+        const T& element) const {
+
+    for (Node* node = head; node; node = node->next) {
+        const T* a = node->data();
+
+        for (std::size_t i = 0; i < node->count; ++i) {
+            if (a[i] == element) {
+                return const_iterator(this, node, i);
+            }
+        }
+    }
+
+    return end();
+}
+
+template <class T, std::size_t N>
+std::size_t UnrolledList<T, N>::count() const {
+    return count_;
+}
+
+template <class T, std::size_t N>
+void UnrolledList<T, N>::clear() {
+    while (head) {
+        Node* next = head->next;
+        T* a = head->data();
+
+        for (std::size_t i = 0; i < head->count; ++i) {
+            std::allocator_traits<allocator_type>::destroy(alloc, &a[i]);
+        }
+
+        pool.destroy(head);
+        head = next;
+    }
+
+    tail = nullptr;
+    count_ = 0;
+}
+
+template <class T, std::size_t N>
+typename UnrolledList<T, N>::iterator UnrolledList<T, N>::begin() {
+    return iterator(this, head, 0);
+}
+
+template <class T, std::size_t N>
+typename UnrolledList<T, N>::iterator UnrolledList<T, N>::end() {
+    return iterator(this, nullptr, 0);
+}
+
+template <class T, std::size_t N>
+typename UnrolledList<T, N>::const_iterator UnrolledList<T, N>::begin() const {
+    return const_iterator(this, head, 0);
+}
+
+template <class T, std::size_t N>
+typename UnrolledList<T, N>::const_iterator UnrolledList<T, N>::end() const {
+    return const_iterator(this, nullptr, 0);
+}
+
+template <class T, std::size_t N>
+typename UnrolledList<T, N>::Node* UnrolledList<T, N>::create_node(Node* prev) {
+    Node* node = pool.create();
+    Node* next = prev ? prev->next : head;
+
+    node->prev = prev;
+    node->next = next;
+
+    if (prev) {
+        prev->next = node;
+    } else {
+        head = node;
+    }
+
+    if (next) {
+        next->prev = node;
+    } else {
+        tail = node;
+    }
+
+    return node;
+}
+
+template <class T, std::size_t N>
+void UnrolledList<T, N>::destroy_node(Node* node) {
+    if (node->prev) {
+        node->prev->next = node->next;
+    } else {
+        head = node->next;
+    }
+
+    if (node->next) {
+        node->next->prev = node->prev;
+    } else {
+        tail = node->prev;
+    }
+
+    pool.destroy(node);
+}
+
+template <class T, std::size_t N>
+typename UnrolledList<T, N>::Node* UnrolledList<T, N>::split(Node* node) {
+    Node* right = create_node(node);
+    std::size_t half = node->count / 2;
+    T* a = node->data();
+    T* b = right->data();
+
+    for (std::size_t i = half; i < node->count; ++i) {
+        std::allocator_traits<allocator_type>::construct(alloc, &b[i - half],
+                std::move(a[i]));
+        std::allocator_traits<allocator_type>::destroy(alloc, &a[i]);
+    }
+
+    right->count = node->count - half;
+    node->count = half;
+
+    return right;
+}
+
+template <class T, std::size_t N>
+template <class U>
+typename UnrolledList<T, N>::iterator UnrolledList<T, N>::emplace_at(
+        Node* node, std::size_t index, U&& element) {
+
+    if (index == node->count && node->count < N) {
+        std::allocator_traits<allocator_type>::construct(alloc,
+                &node->data()[index], std::forward<U>(element));
+
+        ++node->count;
+        ++count_;
+
+        return iterator(this, node, index);
+    }
+
+    T value(std::forward<U>(element));
+
+    if (node->count == N) {
+        Node* right = split(node);
+
+        if (index > node->count) {
+            index -= node->count;
+            node = right;
+        }
+    }
+
+    T* a = node->data();
+
+    if (index == node->count) {
+        std::allocator_traits<allocator_type>::construct(alloc, &a[index],
+                std::move(value));
+    } else {
+        std::allocator_traits<allocator_type>::construct(alloc,
+                &a[node->count], std::move(a[node->count - 1]));
+        std::move_backward(a + index, a + node->count - 1, a + node->count);
+        a[index] = std::move(value);
+    }
+
+    ++node->count;
+    ++count_;
+
+    return iterator(this, node, index);
+}
+
+template <class T, std::size_t N>
+template <class U>
+typename UnrolledList<T, N>::iterator UnrolledList<T, N>::insert_at(
+        iterator position, U&& element) {
+
+    Node* node = position.node;
+    std::size_t index = position.index;
+
+    if (!node) {
+        if (!tail || tail->count == N) {
+            create_node(tail);
+        }
+
+        node = tail;
+        index = tail->count;
+    } else if (!index && node->count == N && node->prev &&
+            node->prev->count < N) {
+        node = node->prev;
+        index = node->count;
+    } else if (!index && node->count == N && node == head) {
+        node = create_node(nullptr);
+    }
+
+    return emplace_at(node, index, std::forward<U>(element));
+}
+
+template <class T, std::size_t N>
+typename UnrolledList<T, N>::iterator UnrolledList<T, N>::erase_at(
+        Node* node, std::size_t index) {
+
+    if (!node || index >= node->count) {
+        throw except::ItemNotFound();
+    }
+
+    T* a = node->data();
+
+    std::move(a + index + 1, a + node->count, a + index);
+    std::allocator_traits<allocator_type>::destroy(alloc, &a[node->count - 1]);
+
+    --node->count;
+    --count_;
+
+    if (!node->count) {
+        Node* next = node->next;
+
+        destroy_node(node);
+
+        return iterator(this, next, 0);
+    }
+
+    Node* next = node->next;
+
+    if (next && node->count < N / 2) {
+        T* b = next->data();
+
+        if (node->count + next->count <= N) {
+            for (std::size_t i = 0; i < next->count; ++i) {
+                std::allocator_traits<allocator_type>::construct(alloc,
+                        &a[node->count + i], std::move(b[i]));
+                std::allocator_traits<allocator_type>::destroy(alloc, &b[i]);
+            }
+
+            node->count += next->count;
+            next->count = 0;
+            destroy_node(next);
+        } else {
+            std::allocator_traits<allocator_type>::construct(alloc,
+                    &a[node->count], std::move(b[0]));
+            ++node->count;
+
+            std::move(b + 1, b + next->count, b);
+            std::allocator_traits<allocator_type>::destroy(alloc,
+                    &b[next->count - 1]);
+            --next->count;
+        }
+    }
+
+    if (index < node->count) {
+        return iterator(this, node, index);
+    }
+
+    return iterator(this, node->next, 0);
+}
+
+}
+}
+}
+
+#endif
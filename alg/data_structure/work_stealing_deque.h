@@ -0,0 +1,194 @@
+#ifndef ALG_DS_WORK_STEALING_DEQUE_H_
+#define ALG_DS_WORK_STEALING_DEQUE_H_
+
+#include <cstddef>
+#include <cstdint>
+
+#include <atomic>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "alg/data_structure/extendable_array.h"
+
+namespace alg {
+namespace ds {
+
+template <class T>
+class WorkStealingDeque {
+    static_assert(std::is_trivially_copyable<T>::value,
+            "WorkStealingDeque requires a trivially copyable element type");
+
+public:
+    explicit WorkStealingDeque(std::size_t n = 64);
+
+    WorkStealingDeque(const WorkStealingDeque<T>&) = delete;
+    WorkStealingDeque<T>& operator=(const WorkStealingDeque<T>&) = delete;
+
+    void push(const T& element);
+    bool pop(T& element);
+
+    bool steal(T& element);
+
+    std::size_t count() const;
+    std::size_t capacity() const;
+
+private:
+    static constexpr std::size_t cache_line = 64;
+
+    class Array {
+    public:
+        std::int64_t capacity;
+        std::int64_t mask;
+        std::unique_ptr<std::atomic<T>[]> cells;
+
+        explicit Array(std::int64_t capacity) :
+            capacity{capacity},
+            mask{capacity - 1},
+            cells{new std::atomic<T>[capacity]} {}
+
+        T get(std::int64_t i) const {
+            return cells[i & mask].load(std::memory_order_relaxed);
+        }
+
+        void put(std::int64_t i, const T& element) {
+            cells[i & mask].store(element, std::memory_order_relaxed);
+        }
+    };
+
+    std::atomic<std::int64_t> top{0};
+
+    char padding0[cache_line];
+
+    std::atomic<std::int64_t> bottom{0};
+    std::atomic<Array*> array;
+
+    char padding1[cache_line];
+
+    ExtendableArray<std::unique_ptr<Array>> arrays;
+
+    Array* grow(Array* a, std::int64_t b, std::int64_t t);
+};
+
+template <class T>
+constexpr std::size_t WorkStealingDeque<T>::cache_line;
+
+template <class T>
+WorkStealingDeque<T>::WorkStealingDeque(std::size_t n) {
+    if (!n) {
+        throw std::invalid_argument("Capacity must be positive");
+    }
+
+    std::int64_t capacity = 1;
+
+    while (static_cast<std::size_t>(capacity) < n) {
+        capacity <<= 1;
+    }
+
+    arrays.append(std::unique_ptr<Array>(new Array(capacity)));
+    array.store(arrays[0].get(), std::memory_order_relaxed);
+}
+
+template <class T>
+void WorkStealingDeque<T>::push(const T& element) {
+    std::int64_t b = bottom.load(std::memory_order_relaxed);
+    std::int64_t t = top.load(std::memory_order_acquire);
+    Array* a = array.load(std::memory_order_relaxed);
+
+    if (b - t > a->capacity - 1) {
+        a = grow(a, b, t);
+    }
+
+    a->put(b, element);
+    std::atomic_thread_fence(std::memory_order_release);
+    bottom.store(b + 1, std::memory_order_relaxed);
+}
+
+template <class T>
+bool WorkStealingDeque<T>::pop(T& element) {
+    std::int64_t b = bottom.load(std::memory_order_relaxed) - 1;
+    Array* a = array.load(std::memory_order_relaxed);
+
+    bottom.store(b, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    std::int64_t t = top.load(std::memory_order_relaxed);
+
+    if (t > b) {
+        bottom.store(b + 1, std::memory_order_relaxed);
+        return false;
+    }
+
+    element = a->get(b);
+
+    if (t == b) {
+        bool won = top.compare_exchange_strong(t, t + 1,
+                std::memory_order_seq_cst, std::memory_order_relaxed);
+
+        bottom.store(b + 1, std::memory_order_relaxed);
+
+        return won;
+    }
+
+    return true;
+}
+
+template <class T>
+bool WorkStealingDeque<T>::steal(T& element) {
+    std::int64_t t = top.load(std::memory_order_acquire);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    std::int64_t b = bottom.load(std::memory_order_acquire);
+
+    if (t >= b) {
+        return false;
+    }
+
+    Array* a = array.load(std::memory_order_acquire);
+    T stolen = a->get(t);
+
+    if (!top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst,
+            std::memory_order_relaxed)) {
+        return false;
+    }
+
+    element = stolen;
+
+    return true;
+}
+
+template <class T>
+std::size_t WorkStealingDeque<T>::count() const {
+    std::int64_t b = bottom.load(std::memory_order_relaxed);
+    std::int64_t t = top.load(std::memory_order_relaxed);
+
+    return b > t ? static_cast<std::size_t>(b - t) : 0;
+}
+
+template <class T>
+std::size_t WorkStealingDeque<T>::capacity() const {
+    return array.load(std::memory_order_relaxed)->capacity;
+}
+
+template <class T>
+typename WorkStealingDeque<T>::Array* WorkStealingDeque<T>::grow(Array* a,
+        std::int64_t b, std::int64_t t) {
+
+    std::unique_ptr<Array> bigger(new Array(2 * a->capacity));
+
+    for (std::int64_t i = t; i < b; ++i) {
+        bigger->put(i, a->get(i));
+    }
+
+    Array* result = bigger.get();
+
+    arrays.append(std::move(bigger));
+    array.store(result, std::memory_order_release);
+
+    return result;
+}
+
+}
+}
+
+#endif
@@ -3,7 +3,7 @@
 
 #include "alg/common/randomizer.h"
 #include "alg/data_structure/extendable_array.h"
-#include "alg/data_structure/queue.h"
+#include "alg/data_structure/extendable_queue.h"
 #include "alg/data_structure/tree/order_statistic_tree.h"
 
 #include "josephus.h"
@@ -37,7 +37,7 @@ std::unique_ptr<ds::tree::OrderStatisticTree<std::size_t>> randomized_ost(
 }
 
 std::size_t josephus_queue(std::size_t n, std::size_t k) {
-    ds::Queue<std::size_t> q(n);
+    ds::ExtendableQueue<std::size_t> q(n);
 
     for (std::size_t i = 1; i <= n; ++i) {
         q.enqueue(i);
@@ -0,0 +1,71 @@
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+
+#include "alg/common/randomizer.h"
+#include "alg/data_structure/extendable_array.h"
+#include "alg/data_structure/priority_queue.h"
+#include "alg/data_structure/split_priority_queue.h"
+
+namespace {
+
+constexpr std::size_t total = 1000000;
+
+template <std::size_t N>
+struct Payload {
+    std::array<char, N> bytes;
+};
+
+template <class Queue, class T>
+double run(const alg::ds::ExtendableArray<std::uint32_t>& priorities) {
+    Queue queue(alg::ds::PriorityQueueType::MIN);
+    T element{};
+
+    auto start = std::chrono::steady_clock::now();
+
+    for (std::size_t i = 0; i < priorities.count(); ++i) {
+        queue.insert(element, priorities[i]);
+
+        if (i % 4 == 3) {
+            queue.pop();
+        }
+    }
+
+    while (queue.count()) {
+        queue.pop();
+    }
+
+    auto end = std::chrono::steady_clock::now();
+
+    return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+template <std::size_t N>
+void compare(const alg::ds::ExtendableArray<std::uint32_t>& priorities) {
+    using T = Payload<N>;
+
+    double interleaved = run<alg::ds::PriorityQueue<T>, T>(priorities);
+    double split = run<alg::ds::SplitPriorityQueue<T>, T>(priorities);
+
+    std::printf("%4zu byte elements: %-18s %8.1f ms  %-18s %8.1f ms\n", N,
+            "PriorityQueue", interleaved, "SplitPriorityQueue", split);
+}
+
+}
+
+int main() {
+    alg::ds::ExtendableArray<std::uint32_t> priorities;
+
+    for (std::size_t i = 0; i < total; ++i) {
+        priorities.append(alg::randomizer::uniform_int<std::uint32_t>(0,
+                1u << 30));
+    }
+
+    compare<4>(priorities);
+    compare<64>(priorities);
+    compare<256>(priorities);
+
+    return 0;
+}
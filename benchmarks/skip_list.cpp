@@ -0,0 +1,139 @@
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+
+#include <algorithm>
+
+#include "alg/common/randomizer.h"
+#include "alg/data_structure/extendable_array.h"
+#include "alg/data_structure/skip_list.h"
+#include "alg/data_structure/tree/red_black_tree.h"
+
+namespace {
+
+constexpr int keys = 200000;
+
+struct Timings {
+    double insert_ms;
+    double search_ms;
+    double erase_ms;
+    std::size_t found;
+};
+
+alg::ds::ExtendableArray<int> shuffled() {
+    alg::ds::ExtendableArray<int> order;
+
+    order.reserve(keys);
+
+    for (int i = 0; i < keys; ++i) {
+        order.append(i);
+    }
+
+    for (int i = keys - 1; i > 0; --i) {
+        std::swap(order[i], order[alg::randomizer::uniform_int(0, i)]);
+    }
+
+    return order;
+}
+
+double since(std::chrono::steady_clock::time_point start) {
+    auto end = std::chrono::steady_clock::now();
+
+    return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+template <class Set, class Insert, class Search, class Erase>
+Timings run(const alg::ds::ExtendableArray<int>& order, Set& set,
+        Insert insert, Search search, Erase erase) {
+
+    Timings t;
+    t.found = 0;
+
+    auto start = std::chrono::steady_clock::now();
+
+    for (std::size_t i = 0; i < order.count(); ++i) {
+        insert(set, order[i]);
+    }
+
+    t.insert_ms = since(start);
+    start = std::chrono::steady_clock::now();
+
+    for (std::size_t i = 0; i < order.count(); ++i) {
+        t.found += search(set, order[i]);
+        t.found += search(set, order[i] + keys);
+    }
+
+    t.search_ms = since(start);
+    start = std::chrono::steady_clock::now();
+
+    for (std::size_t i = 0; i < order.count(); ++i) {
+        erase(set, order[i]);
+    }
+
+    t.erase_ms = since(start);
+
+    return t;
+}
+
+void print(const char* name, const Timings& t) {
+    std::printf("%-16s %10.1f %10.1f %10.1f  (%zu found)\n", name,
+            t.insert_ms, t.search_ms, t.erase_ms, t.found);
+}
+
+}
+
+int main() {
+    using Tree = alg::ds::tree::RedBlackTree<int>;
+    using List = alg::ds::SkipList<int>;
+
+    alg::ds::ExtendableArray<int> random = shuffled();
+    alg::ds::ExtendableArray<int> sorted;
+
+    sorted.reserve(keys);
+
+    for (int i = 0; i < keys; ++i) {
+        sorted.append(i);
+    }
+
+    auto list_insert = [](List& l, int key) { l.insert(key); };
+    auto list_search = [](List& l, int key) { return l.contains(key); };
+    auto list_erase = [](List& l, int key) { l.erase(key); };
+
+    auto tree_insert = [](Tree& t, int key) { t.insert(key); };
+    auto tree_search = [](Tree& t, int key) {
+        return t.search(key) != t.nil();
+    };
+    auto tree_erase = [](Tree& t, int key) { t.remove(t.search(key)); };
+
+    std::printf("%-16s %10s %10s %10s\n", "random keys", "insert ms",
+            "search ms", "erase ms");
+
+    {
+        List list;
+        print("SkipList", run(random, list, list_insert, list_search,
+                list_erase));
+    }
+
+    {
+        Tree tree;
+        print("RedBlackTree", run(random, tree, tree_insert, tree_search,
+                tree_erase));
+    }
+
+    std::printf("%-16s %10s %10s %10s\n", "sorted keys", "insert ms",
+            "search ms", "erase ms");
+
+    {
+        List list;
+        print("SkipList", run(sorted, list, list_insert, list_search,
+                list_erase));
+    }
+
+    {
+        Tree tree;
+        print("RedBlackTree", run(sorted, tree, tree_insert, tree_search,
+                tree_erase));
+    }
+
+    return 0;
+}
@@ -0,0 +1,137 @@
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+
+#include "alg/common/randomizer.h"
+#include "alg/data_structure/extendable_array.h"
+#include "alg/data_structure/priority_queue.h"
+#include "alg/data_structure/timing_wheel.h"
+
+namespace {
+
+constexpr std::uint32_t ticks = 60000;
+constexpr std::size_t arms_per_tick = 200;
+constexpr std::uint32_t max_timeout = 30000;
+constexpr int cancel_percent = 90;
+
+struct Op {
+    std::uint32_t timeout;
+    bool cancel;
+};
+
+alg::ds::ExtendableArray<Op> workload() {
+    alg::ds::ExtendableArray<Op> ops;
+
+    ops.reserve(ticks * arms_per_tick);
+
+    for (std::size_t i = 0; i < ticks * arms_per_tick; ++i) {
+        Op op;
+
+        op.timeout = alg::randomizer::uniform_int<std::uint32_t>(1,
+                max_timeout);
+        op.cancel = alg::randomizer::uniform_int(0, 99) < cancel_percent;
+
+        ops.append(op);
+    }
+
+    return ops;
+}
+
+template <class Queue, class Arm, class Cancel, class Expire>
+double run(const alg::ds::ExtendableArray<Op>& ops, Queue& queue, Arm arm,
+        Cancel cancel, Expire expire, std::size_t& fired) {
+
+    using Handle = typename Queue::Handle;
+
+    alg::ds::ExtendableArray<Handle> pending;
+    std::size_t op = 0;
+
+    auto start = std::chrono::steady_clock::now();
+
+    for (std::uint32_t now = 1; now <= ticks + max_timeout; ++now) {
+        for (std::size_t i = 0; now <= ticks && i < arms_per_tick; ++i) {
+            Handle handle = arm(queue, op, now + ops[op].timeout);
+
+            if (ops[op].cancel) {
+                pending.append(handle);
+            }
+
+            ++op;
+        }
+
+        while (pending.count() > arms_per_tick) {
+            cancel(queue, pending[pending.count() - 1]);
+            pending.remove(pending.count() - 1);
+        }
+
+        fired += expire(queue, now);
+    }
+
+    for (std::size_t i = 0; i < pending.count(); ++i) {
+        cancel(queue, pending[i]);
+    }
+
+    auto end = std::chrono::steady_clock::now();
+
+    return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+}
+
+int main() {
+    alg::ds::ExtendableArray<Op> ops = workload();
+
+    using Wheel = alg::ds::TimingWheel<std::size_t>;
+    using Queue = alg::ds::PriorityQueue<std::size_t>;
+
+    Wheel wheel;
+    std::size_t wheel_fired = 0;
+
+    double wheel_ms = run(ops, wheel,
+            [](Wheel& w, std::size_t id, std::uint32_t expires) {
+                return w.schedule(id, expires);
+            },
+            [](Wheel& w, Wheel::Handle handle) {
+                if (w.contains(handle)) {
+                    w.cancel(handle);
+                }
+            },
+            [](Wheel& w, std::uint32_t now) {
+                return w.advance(now, [](std::size_t&) {});
+            },
+            wheel_fired);
+
+    Queue queue(alg::ds::PriorityQueueType::MIN);
+    std::size_t queue_fired = 0;
+
+    double queue_ms = run(ops, queue,
+            [](Queue& q, std::size_t id, std::uint32_t expires) {
+                return q.insert(id, expires);
+            },
+            [](Queue& q, Queue::Handle handle) {
+                if (q.contains(handle)) {
+                    q.erase(handle);
+                }
+            },
+            [](Queue& q, std::uint32_t now) {
+                std::size_t fired = 0;
+
+                while (q.count() && q.top_priority() <= now) {
+                    q.pop();
+                    ++fired;
+                }
+
+                return fired;
+            },
+            queue_fired);
+
+    std::printf("timer churn: %zu arms, %d%% cancelled\n", ops.count(),
+            cancel_percent);
+    std::printf("%-16s %10.1f ms  (%zu fired)\n", "TimingWheel", wheel_ms,
+            wheel_fired);
+    std::printf("%-16s %10.1f ms  (%zu fired)\n", "PriorityQueue", queue_ms,
+            queue_fired);
+
+    return 0;
+}
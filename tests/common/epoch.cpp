@@ -0,0 +1,81 @@
+#include <cstddef>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "alg/common/epoch.h"
+
+namespace algtest {
+
+namespace {
+
+std::atomic<int> freed{0};
+
+void count_free(void* p) {
+    delete static_cast<int*>(p);
+    freed.fetch_add(1);
+}
+
+}
+
+TEST(EpochDomain, RetiredFreedAfterTwoEpochs) {
+    freed = 0;
+
+    alg::memory::EpochDomain domain(4);
+
+    {
+        alg::memory::EpochDomain::Guard guard = domain.pin();
+        guard.retire(new int(1), count_free);
+    }
+
+    ASSERT_EQ(0, freed.load());
+    ASSERT_EQ(1, domain.pending());
+
+    for (int i = 0; i < 200; ++i) {
+        alg::memory::EpochDomain::Guard guard = domain.pin();
+        guard.retire(new int(i), count_free);
+    }
+
+    ASSERT_GT(domain.epoch(), 0);
+    ASSERT_GT(freed.load(), 0);
+    ASSERT_EQ(201, freed.load() + domain.pending());
+}
+
+TEST(EpochDomain, PinnedReaderBlocksReclamation) {
+    freed = 0;
+
+    alg::memory::EpochDomain domain(4);
+    alg::memory::EpochDomain::Guard reader = domain.pin();
+
+    std::thread writer([&domain] {
+        for (int i = 0; i < 500; ++i) {
+            alg::memory::EpochDomain::Guard guard = domain.pin();
+            guard.retire(new int(i), count_free);
+        }
+    });
+
+    writer.join();
+
+    ASSERT_LE(domain.epoch(), 1);
+    ASSERT_EQ(0, freed.load());
+}
+
+TEST(EpochDomain, DestructorFreesPending) {
+    freed = 0;
+
+    {
+        alg::memory::EpochDomain domain;
+        alg::memory::EpochDomain::Guard guard = domain.pin();
+
+        for (int i = 0; i < 10; ++i) {
+            guard.retire(new int(i), count_free);
+        }
+    }
+
+    ASSERT_EQ(10, freed.load());
+}
+
+}
@@ -0,0 +1,136 @@
+#include <cstddef>
+
+#include <set>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "alg/common/node_pool.h"
+#include "alg/common/randomizer.h"
+
+namespace algtest {
+
+TEST(NodePool, CreateDestroy) {
+    alg::memory::NodePool<std::string> pool(4);
+
+    ASSERT_EQ(0, pool.count());
+    ASSERT_EQ(0, pool.capacity());
+
+    std::string* a = pool.create("foo");
+    std::string* b = pool.create(3, 'x');
+
+    ASSERT_EQ("foo", *a);
+    ASSERT_EQ("xxx", *b);
+    ASSERT_EQ(2, pool.count());
+    ASSERT_EQ(4, pool.capacity());
+
+    pool.destroy(a);
+
+    std::string* c = pool.create("bar");
+
+    ASSERT_EQ(a, c);
+    ASSERT_EQ(2, pool.count());
+
+    pool.destroy(b);
+    pool.destroy(c);
+
+    ASSERT_EQ(0, pool.count());
+}
+
+TEST(NodePool, Growth) {
+    alg::memory::NodePool<int> pool(2);
+    std::set<int*> addresses;
+
+    for (int i = 0; i < 100; ++i) {
+        int* p = pool.create(i);
+
+        ASSERT_TRUE(addresses.insert(p).second);
+        ASSERT_EQ(i, *p);
+    }
+
+    ASSERT_EQ(100, pool.count());
+    ASSERT_LE(100, pool.capacity());
+
+    for (int* p : addresses) {
+        pool.destroy(p);
+    }
+
+    ASSERT_EQ(0, pool.count());
+}
+
+TEST(NodePool, Splice) {
+    alg::memory::NodePool<int> lhs(4);
+    alg::memory::NodePool<int> rhs(4);
+
+    int* a = lhs.create(2);
+    int* b = rhs.create(3);
+    int* c = rhs.create(5);
+
+    std::size_t capacity = lhs.capacity() + rhs.capacity();
+
+    lhs.splice(rhs);
+
+    ASSERT_EQ(3, lhs.count());
+    ASSERT_EQ(capacity, lhs.capacity());
+    ASSERT_EQ(0, rhs.count());
+    ASSERT_EQ(0, rhs.capacity());
+
+    lhs.destroy(a);
+    lhs.destroy(b);
+    lhs.destroy(c);
+
+    for (std::size_t i = 0; i < capacity; ++i) {
+        lhs.create(static_cast<int>(i));
+    }
+
+    ASSERT_EQ(capacity, lhs.capacity());
+
+    int* d = rhs.create(7);
+
+    ASSERT_EQ(7, *d);
+    ASSERT_EQ(1, rhs.count());
+}
+
+TEST(NodePool, Release) {
+    alg::memory::NodePool<int> pool;
+
+    for (int i = 0; i < 1000; ++i) {
+        pool.create(i);
+    }
+
+    pool.release();
+
+    ASSERT_EQ(0, pool.count());
+    ASSERT_EQ(0, pool.capacity());
+    ASSERT_EQ(2, *pool.create(2));
+}
+
+TEST(NodePool, LargeRandomDataSet) {
+    constexpr int total = 100000;
+    alg::memory::NodePool<std::string> pool;
+    std::vector<std::string*> live;
+
+    for (int i = 0; i < total; ++i) {
+        live.push_back(pool.create(std::to_string(i)));
+
+        if (alg::randomizer::uniform_int(0, 2) == 0) {
+            std::size_t j = alg::randomizer::uniform_int<std::size_t>(0,
+                    live.size() - 1);
+
+            pool.destroy(live[j]);
+            live[j] = live.back();
+            live.pop_back();
+        }
+
+        ASSERT_EQ(live.size(), pool.count());
+    }
+
+    for (std::string* p : live) {
+        pool.destroy(p);
+    }
+
+    ASSERT_EQ(0, pool.count());
+}
+
+}
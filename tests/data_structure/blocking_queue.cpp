@@ -0,0 +1,176 @@
+#include <chrono>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "alg/data_structure/blocking_queue.h"
+
+namespace algtest {
+
+TEST(BlockingQueue, ZeroCapacity) {
+    ASSERT_THROW(alg::ds::BlockingQueue<int>(0), std::invalid_argument);
+}
+
+TEST(BlockingQueue, EnqueueDequeue) {
+    alg::ds::BlockingQueue<int> q(4);
+
+    ASSERT_EQ(4, q.capacity());
+
+    for (int i = 0; i < 4; ++i) {
+        ASSERT_TRUE(q.enqueue(i));
+    }
+
+    ASSERT_EQ(4, q.count());
+
+    for (int i = 0; i < 4; ++i) {
+        int x;
+
+        ASSERT_TRUE(q.dequeue(x));
+        ASSERT_EQ(i, x);
+    }
+
+    ASSERT_EQ(0, q.count());
+}
+
+TEST(BlockingQueue, Timeouts) {
+    alg::ds::BlockingQueue<int> q(1);
+    int x;
+
+    auto start = std::chrono::steady_clock::now();
+    ASSERT_FALSE(q.try_dequeue_for(x, std::chrono::milliseconds(20)));
+    ASSERT_GE(std::chrono::steady_clock::now() - start,
+            std::chrono::milliseconds(20));
+
+    ASSERT_TRUE(q.try_enqueue_for(1, std::chrono::milliseconds(20)));
+    ASSERT_FALSE(q.try_enqueue_for(2, std::chrono::milliseconds(20)));
+
+    ASSERT_TRUE(q.try_dequeue_for(x, std::chrono::milliseconds(20)));
+    ASSERT_EQ(1, x);
+}
+
+TEST(BlockingQueue, Close) {
+    alg::ds::BlockingQueue<int> q(4);
+
+    q.enqueue(1);
+    q.enqueue(2);
+
+    std::thread closer([&q] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        q.close();
+    });
+
+    std::vector<int> items;
+
+    ASSERT_EQ(2, q.drain(std::back_inserter(items), 8));
+    ASSERT_EQ(0, q.drain(std::back_inserter(items), 8));
+
+    closer.join();
+
+    ASSERT_TRUE(q.is_closed());
+    ASSERT_FALSE(q.enqueue(3));
+    ASSERT_EQ((std::vector<int>{1, 2}), items);
+
+    int x;
+    ASSERT_FALSE(q.dequeue(x));
+}
+
+TEST(BlockingQueue, CloseWakesProducer) {
+    alg::ds::BlockingQueue<int> q(1);
+    bool accepted = true;
+
+    q.enqueue(1);
+
+    std::thread producer([&q, &accepted] {
+        accepted = q.enqueue(2);
+    });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    q.close();
+    producer.join();
+
+    ASSERT_FALSE(accepted);
+    ASSERT_EQ(1, q.count());
+}
+
+TEST(BlockingQueue, Drain) {
+    alg::ds::BlockingQueue<int> q(8);
+
+    for (int i = 0; i < 8; ++i) {
+        q.enqueue(i);
+    }
+
+    std::vector<int> items;
+
+    ASSERT_EQ(0, q.drain(std::back_inserter(items), 0));
+    ASSERT_EQ(5, q.drain(std::back_inserter(items), 5));
+    ASSERT_EQ(3, q.drain(std::back_inserter(items), 5));
+    ASSERT_EQ((std::vector<int>{0, 1, 2, 3, 4, 5, 6, 7}), items);
+}
+
+TEST(BlockingQueue, MoveOnly) {
+    alg::ds::BlockingQueue<std::unique_ptr<int>> q(2);
+
+    ASSERT_TRUE(q.enqueue(std::unique_ptr<int>(new int(7))));
+    ASSERT_TRUE(q.try_enqueue_for(std::unique_ptr<int>(new int(8)),
+            std::chrono::milliseconds(1)));
+
+    std::unique_ptr<int> p;
+
+    ASSERT_TRUE(q.dequeue(p));
+    ASSERT_EQ(7, *p);
+    ASSERT_TRUE(q.try_dequeue_for(p, std::chrono::milliseconds(1)));
+    ASSERT_EQ(8, *p);
+}
+
+TEST(BlockingQueue, Pipeline) {
+    constexpr int producers = 3;
+    constexpr int items = 20000;
+
+    alg::ds::BlockingQueue<int> q(64);
+    std::vector<std::thread> threads;
+
+    for (int p = 0; p < producers; ++p) {
+        threads.emplace_back([&q] {
+            for (int i = 1; i <= items; ++i) {
+                q.enqueue(i);
+            }
+        });
+    }
+
+    long long sum = 0;
+    std::size_t received = 0;
+
+    std::thread consumer([&] {
+        std::vector<int> batch;
+
+        while (true) {
+            batch.clear();
+
+            if (!q.drain(std::back_inserter(batch), 32)) {
+                break;
+            }
+
+            for (int x : batch) {
+                sum += x;
+            }
+
+            received += batch.size();
+        }
+    });
+
+    for (std::thread& t : threads) {
+        t.join();
+    }
+
+    q.close();
+    consumer.join();
+
+    ASSERT_EQ(static_cast<std::size_t>(producers * items), received);
+    ASSERT_EQ(producers * (items * (items + 1LL) / 2), sum);
+}
+
+}
@@ -0,0 +1,145 @@
+#include <cstddef>
+
+#include <atomic>
+#include <map>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "alg/common/randomizer.h"
+#include "alg/data_structure/concurrent_skip_list_map.h"
+
+namespace algtest {
+
+TEST(ConcurrentSkipListMap, InsertFindErase) {
+    alg::ds::ConcurrentSkipListMap<int, std::string> map;
+    std::string value;
+
+    ASSERT_EQ(0, map.count());
+    ASSERT_FALSE(map.contains(1));
+    ASSERT_FALSE(map.erase(1));
+
+    ASSERT_TRUE(map.insert(2, "two"));
+    ASSERT_TRUE(map.insert(1, "one"));
+    ASSERT_TRUE(map.insert(3, "three"));
+    ASSERT_FALSE(map.insert(2, "deux"));
+
+    ASSERT_EQ(3, map.count());
+    ASSERT_TRUE(map.find(2, value));
+    ASSERT_EQ("two", value);
+    ASSERT_FALSE(map.find(4, value));
+
+    std::vector<std::pair<int, std::string>> entries;
+    map.for_each([&entries](const int& k, const std::string& v) {
+        entries.emplace_back(k, v);
+    });
+
+    ASSERT_EQ((std::vector<std::pair<int, std::string>>{
+            {1, "one"}, {2, "two"}, {3, "three"}}), entries);
+
+    ASSERT_TRUE(map.erase(2));
+    ASSERT_FALSE(map.erase(2));
+    ASSERT_FALSE(map.contains(2));
+    ASSERT_EQ(2, map.count());
+
+    ASSERT_TRUE(map.insert(2, "deux"));
+    ASSERT_TRUE(map.find(2, value));
+    ASSERT_EQ("deux", value);
+}
+
+TEST(ConcurrentSkipListMap, Random) {
+    alg::ds::ConcurrentSkipListMap<int, int> map;
+    std::map<int, int> model;
+
+    for (int step = 0; step < 20000; ++step) {
+        int k = alg::randomizer::uniform_int(0, 1000);
+
+        if (alg::randomizer::uniform_int(0, 1)) {
+            ASSERT_EQ(model.emplace(k, step).second, map.insert(k, step));
+        } else {
+            ASSERT_EQ(model.erase(k) == 1, map.erase(k));
+        }
+
+        ASSERT_EQ(model.size(), map.count());
+    }
+
+    auto it = model.begin();
+
+    map.for_each([&it](const int& k, const int& v) {
+        ASSERT_EQ(it->first, k);
+        ASSERT_EQ(it->second, v);
+        ++it;
+    });
+
+    ASSERT_TRUE(it == model.end());
+}
+
+TEST(ConcurrentSkipListMap, ConcurrentReadersAndWriters) {
+    constexpr int writers = 4;
+    constexpr int readers = 4;
+    constexpr int keys = 2000;
+    constexpr int rounds = 5;
+
+    alg::ds::ConcurrentSkipListMap<int, int> map;
+    std::atomic<bool> done{false};
+    std::atomic<int> bad{0};
+    std::vector<std::thread> threads;
+
+    for (int w = 0; w < writers; ++w) {
+        threads.emplace_back([&map, w] {
+            for (int round = 0; round < rounds; ++round) {
+                for (int k = w; k < keys; k += writers) {
+                    map.insert(k, k * 10);
+                }
+
+                for (int k = w; k < keys; k += 2 * writers) {
+                    map.erase(k);
+                }
+            }
+        });
+    }
+
+    for (int r = 0; r < readers; ++r) {
+        threads.emplace_back([&map, &done, &bad] {
+            while (!done.load()) {
+                for (int k = 0; k < keys; k += 7) {
+                    int value;
+
+                    if (map.find(k, value) && value != k * 10) {
+                        bad.fetch_add(1);
+                    }
+                }
+
+                std::this_thread::yield();
+            }
+        });
+    }
+
+    for (int w = 0; w < writers; ++w) {
+        threads[w].join();
+    }
+
+    done = true;
+
+    for (std::size_t i = writers; i < threads.size(); ++i) {
+        threads[i].join();
+    }
+
+    ASSERT_EQ(0, bad.load());
+    ASSERT_EQ(keys / 2, map.count());
+
+    int seen = 0;
+
+    map.for_each([&](const int& k, const int& v) {
+        ASSERT_EQ(k * 10, v);
+        ASSERT_GE(k % (2 * writers), writers);
+        ++seen;
+    });
+
+    ASSERT_EQ(keys / 2, seen);
+}
+
+}
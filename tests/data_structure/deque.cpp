@@ -1,8 +1,14 @@
+#include <deque>
+#include <memory>
+#include <stdexcept>
+#include <string>
 #include <type_traits>
+#include <utility>
 
 #include <gtest/gtest.h>
 
 #include "alg/common/exception.h"
+#include "alg/common/randomizer.h"
 #include "alg/data_structure/deque.h"
 
 namespace algtest {
@@ -101,4 +107,116 @@ TEST_F(Deque, ConstOverloads) {
     static_assert(std::is_same<decltype(cdeq.front()), const int&>::value, "");
 }
 
+TEST_F(Deque, RandomAccess) {
+    alg::ds::Deque<std::string> deq;
+
+    ASSERT_THROW(deq[0], std::out_of_range);
+
+    for (int i = 0; i < 100; ++i) {
+        deq.push_back(std::to_string(i));
+        deq.push_front(std::to_string(-i));
+    }
+
+    ASSERT_EQ(200, deq.count());
+
+    for (int i = 0; i < 100; ++i) {
+        ASSERT_EQ(std::to_string(i - 99), deq[i]);
+        ASSERT_EQ(std::to_string(i), deq[100 + i]);
+    }
+
+    deq[5] = "five";
+
+    ASSERT_EQ("five", deq[5]);
+    ASSERT_THROW(deq[200], std::out_of_range);
+}
+
+TEST_F(Deque, MoveOnly) {
+    alg::ds::Deque<std::unique_ptr<int>> deq;
+
+    deq.push_back(std::unique_ptr<int>(new int(1)));
+    deq.emplace_back(new int(2));
+    deq.push_front(std::unique_ptr<int>(new int(0)));
+    deq.emplace_front(new int(-1));
+
+    ASSERT_EQ(-1, *deq.front());
+    ASSERT_EQ(2, *deq.back());
+    ASSERT_EQ(0, *deq[1]);
+
+    alg::ds::Deque<std::unique_ptr<int>> moved(std::move(deq));
+
+    ASSERT_EQ(0, deq.count());
+    ASSERT_EQ(4, moved.count());
+
+    deq = std::move(moved);
+
+    ASSERT_EQ(4, deq.count());
+    ASSERT_EQ(1, *deq[2]);
+}
+
+TEST_F(Deque, CopyAndClear) {
+    alg::ds::Deque<int> deq;
+
+    for (int i = 0; i < 5000; ++i) {
+        deq.push_back(i);
+    }
+
+    alg::ds::Deque<int> copy(deq);
+    alg::ds::Deque<int> assigned;
+
+    assigned = copy;
+    deq.clear();
+
+    assert_empty(deq);
+
+    deq.shrink_to_fit();
+    deq.push_front(7);
+
+    ASSERT_EQ(7, deq.front());
+
+    for (int i = 0; i < 5000; ++i) {
+        ASSERT_EQ(i, copy[i]);
+        ASSERT_EQ(i, assigned[i]);
+    }
+}
+
+TEST_F(Deque, LargeDataSet) {
+    constexpr int total = 200000;
+
+    alg::ds::Deque<int> alg_deq;
+    std::deque<int> std_deq;
+
+    for (int i = 0; i < total; ++i) {
+        int op = alg::randomizer::uniform_int(0, 9);
+
+        if (op < 3) {
+            alg_deq.push_back(i);
+            std_deq.push_back(i);
+        } else if (op < 6) {
+            alg_deq.push_front(i);
+            std_deq.push_front(i);
+        } else if (std_deq.empty()) {
+            assert_empty(alg_deq);
+        } else if (op < 8) {
+            ASSERT_EQ(std_deq.back(), alg_deq.back());
+
+            alg_deq.pop_back();
+            std_deq.pop_back();
+        } else {
+            ASSERT_EQ(std_deq.front(), alg_deq.front());
+
+            alg_deq.pop_front();
+            std_deq.pop_front();
+        }
+
+        ASSERT_EQ(std_deq.size(), alg_deq.count());
+
+        if (!std_deq.empty()) {
+            int j = alg::randomizer::uniform_int(0,
+                    static_cast<int>(std_deq.size()) - 1);
+
+            ASSERT_EQ(std_deq[j], alg_deq[j]);
+        }
+    }
+}
+
 }
@@ -1,5 +1,6 @@
 #include <cstddef>
 
+#include <memory>
 #include <stdexcept>
 #include <string>
 #include <utility>
@@ -13,6 +14,37 @@
 
 namespace algtest {
 
+namespace {
+
+class ThrowingCopy {
+public:
+    static int live;
+    static int copies_left;
+
+    explicit ThrowingCopy(int value) : value{value} {
+        ++live;
+    }
+
+    ThrowingCopy(const ThrowingCopy& rhs) : value{rhs.value} {
+        if (!copies_left--) {
+            throw std::runtime_error("copy");
+        }
+
+        ++live;
+    }
+
+    ~ThrowingCopy() {
+        --live;
+    }
+
+    int value;
+};
+
+int ThrowingCopy::live = 0;
+int ThrowingCopy::copies_left = 0;
+
+}
+
 TEST(ExtendableArray, InvalidIndex) {
     alg::ds::ExtendableArray<int> array;
 
@@ -91,6 +123,90 @@ TEST(ExtendableArray, Append) {
     }
 }
 
+TEST(ExtendableArray, EmplaceBackMoveOnly) {
+    alg::ds::ExtendableArray<std::unique_ptr<int>> array;
+
+    for (int i = 0; i < 100; ++i) {
+        if (i % 2) {
+            array.append(std::unique_ptr<int>(new int(i)));
+        } else {
+            array.emplace_back(new int(i));
+        }
+    }
+
+    ASSERT_EQ(100, array.count());
+
+    for (int i = 0; i < 100; ++i) {
+        ASSERT_EQ(i, *array[i]);
+    }
+}
+
+TEST(ExtendableArray, ThrowingRelocation) {
+    {
+        alg::ds::ExtendableArray<ThrowingCopy> array;
+
+        ThrowingCopy::copies_left = 100;
+
+        for (int i = 0; i < 4; ++i) {
+            array.emplace_back(i);
+        }
+
+        ASSERT_EQ(4, array.capacity());
+
+        ThrowingCopy::copies_left = 2;
+        ASSERT_THROW(array.emplace_back(4), std::runtime_error);
+
+        ThrowingCopy::copies_left = 2;
+        ASSERT_THROW(array.reserve(16), std::runtime_error);
+
+        ASSERT_EQ(4, array.count());
+        ASSERT_EQ(4, array.capacity());
+        ASSERT_EQ(4, ThrowingCopy::live);
+
+        for (int i = 0; i < 4; ++i) {
+            ASSERT_EQ(i, array[i].value);
+        }
+    }
+
+    ASSERT_EQ(0, ThrowingCopy::live);
+}
+
+TEST(ExtendableArray, AppendOwnElement) {
+    alg::ds::ExtendableArray<std::string> array;
+
+    array.append(std::string(32, 'a'));
+
+    for (std::size_t i = 1; i < 64; ++i) {
+        ASSERT_EQ(i, array.count());
+
+        if (i % 2) {
+            array.append(array[i - 1]);
+        } else {
+            array.emplace_back(array[0]);
+        }
+    }
+
+    for (std::size_t i = 0; i < array.count(); ++i) {
+        ASSERT_EQ(std::string(32, 'a'), array[i]);
+    }
+}
+
+TEST(ExtendableArray, Clear) {
+    alg::ds::ExtendableArray<std::string> array = {"a", "b", "c"};
+    std::size_t capacity = array.capacity();
+
+    array.clear();
+
+    ASSERT_EQ(0, array.count());
+    ASSERT_EQ(capacity, array.capacity());
+    ASSERT_THROW(array[0], std::out_of_range);
+
+    array.append("d");
+
+    ASSERT_EQ(1, array.count());
+    ASSERT_EQ("d", array[0]);
+}
+
 TEST(ExtendableArray, CopyConstructor) {
     alg::ds::ExtendableArray<int> a = {0, 1, 2, 3, 4};
 
@@ -0,0 +1,262 @@
+#include <deque>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "alg/common/exception.h"
+#include "alg/common/randomizer.h"
+#include "alg/data_structure/extendable_queue.h"
+
+namespace algtest {
+
+namespace {
+
+class ThrowingCopy {
+public:
+    static int live;
+    static int copies_left;
+
+    explicit ThrowingCopy(int value) : value{value} {
+        ++live;
+    }
+
+    ThrowingCopy(const ThrowingCopy& rhs) : value{rhs.value} {
+        if (!copies_left--) {
+            throw std::runtime_error("copy");
+        }
+        ++live;
+    }
+
+    ~ThrowingCopy() {
+        --live;
+    }
+
+    int value;
+};
+
+int ThrowingCopy::live = 0;
+int ThrowingCopy::copies_left = 0;
+
+}
+
+TEST(ExtendableQueue, Empty) {
+    alg::ds::ExtendableQueue<int> q;
+
+    ASSERT_EQ(0, q.count());
+    ASSERT_EQ(0, q.capacity());
+    ASSERT_THROW(q.dequeue(), alg::except::BufferEmpty);
+    ASSERT_THROW(q.front(), alg::except::BufferEmpty);
+}
+
+TEST(ExtendableQueue, GrowWrapped) {
+    alg::ds::ExtendableQueue<std::string> q(3);
+
+    ASSERT_EQ(4, q.capacity());
+
+    q.enqueue("0");
+    q.enqueue("1");
+    q.enqueue("2");
+
+    ASSERT_EQ("0", q.dequeue());
+    ASSERT_EQ("1", q.dequeue());
+
+    for (int i = 3; i < 10; ++i) {
+        q.enqueue(std::to_string(i));
+    }
+
+    ASSERT_EQ(8, q.count());
+    ASSERT_EQ(8, q.capacity());
+    ASSERT_EQ("2", q.front());
+
+    for (int i = 2; i < 10; ++i) {
+        ASSERT_EQ(std::to_string(i), q.dequeue());
+    }
+
+    ASSERT_EQ(0, q.count());
+}
+
+TEST(ExtendableQueue, EnqueueFront) {
+    alg::ds::ExtendableQueue<std::string> q(4);
+    std::string element(32, 'q');
+
+    q.enqueue(std::string(32, 'x'));
+    q.dequeue();
+
+    q.enqueue(element);
+
+    for (int i = 1; i < 40; ++i) {
+        q.enqueue(q.front());
+    }
+
+    ASSERT_EQ(40, q.count());
+
+    while (q.count()) {
+        ASSERT_EQ(element, q.dequeue());
+    }
+}
+
+TEST(ExtendableQueue, ThrowingRelocation) {
+    {
+        alg::ds::ExtendableQueue<ThrowingCopy> q(4);
+
+        ThrowingCopy::copies_left = 100;
+
+        q.emplace(-1);
+        q.dequeue();
+
+        for (int i = 0; i < 4; ++i) {
+            q.emplace(i);
+        }
+
+        ThrowingCopy::copies_left = 2;
+
+        ASSERT_THROW(q.emplace(4), std::runtime_error);
+
+        ThrowingCopy::copies_left = 2;
+
+        ASSERT_THROW(q.reserve(16), std::runtime_error);
+
+        ASSERT_EQ(4, q.count());
+        ASSERT_EQ(4, q.capacity());
+        ASSERT_EQ(4, ThrowingCopy::live);
+
+        ThrowingCopy::copies_left = 100;
+
+        for (int i = 0; i < 4; ++i) {
+            ASSERT_EQ(i, q.front().value);
+            q.dequeue();
+        }
+    }
+
+    ASSERT_EQ(0, ThrowingCopy::live);
+}
+
+TEST(ExtendableQueue, MoveOnly) {
+    alg::ds::ExtendableQueue<std::unique_ptr<int>> q;
+
+    for (int i = 0; i < 5; ++i) {
+        q.enqueue(std::unique_ptr<int>(new int(i)));
+        q.emplace(new int(i + 100));
+    }
+
+    for (int i = 0; i < 5; ++i) {
+        ASSERT_EQ(i, *q.dequeue());
+        ASSERT_EQ(i + 100, *q.dequeue());
+    }
+
+    std::unique_ptr<int> items[3];
+    items[0].reset(new int(7));
+    items[1].reset(new int(8));
+    items[2].reset(new int(9));
+
+    q.enqueue_bulk(std::make_move_iterator(items), 3);
+
+    ASSERT_EQ(7, *q.dequeue());
+
+    alg::ds::ExtendableQueue<std::unique_ptr<int>> moved(std::move(q));
+
+    ASSERT_EQ(0, q.count());
+    ASSERT_EQ(2, moved.count());
+    ASSERT_EQ(8, *moved.front());
+}
+
+TEST(ExtendableQueue, Bulk) {
+    alg::ds::ExtendableQueue<int> q(8);
+    std::vector<int> input = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+    std::vector<int> output(10, -1);
+
+    q.enqueue_bulk(input.begin(), 6);
+
+    ASSERT_EQ(4, q.dequeue_bulk(output.begin(), 4));
+
+    q.enqueue_bulk(input.begin() + 6, 4);
+
+    ASSERT_EQ(6, q.count());
+    ASSERT_EQ(8, q.capacity());
+
+    q.enqueue_bulk(input.begin(), 10);
+
+    ASSERT_EQ(16, q.count());
+    ASSERT_EQ(16, q.capacity());
+    ASSERT_EQ(6, q.dequeue_bulk(output.begin() + 4, 6));
+    ASSERT_EQ(input, output);
+    ASSERT_EQ(10, q.dequeue_bulk(output.begin(), 20));
+    ASSERT_EQ(input, output);
+    ASSERT_EQ(0, q.dequeue_bulk(output.begin(), 1));
+}
+
+TEST(ExtendableQueue, CopyAndAssign) {
+    alg::ds::ExtendableQueue<std::string> q(4);
+
+    q.enqueue("a");
+    q.enqueue("b");
+    q.dequeue();
+    q.enqueue("c");
+    q.enqueue("d");
+    q.enqueue("e");
+
+    alg::ds::ExtendableQueue<std::string> copy(q);
+    alg::ds::ExtendableQueue<std::string> assigned;
+
+    assigned = copy;
+
+    for (const char* s : {"b", "c", "d", "e"}) {
+        ASSERT_EQ(s, copy.dequeue());
+        ASSERT_EQ(s, assigned.dequeue());
+    }
+
+    ASSERT_EQ(4, q.count());
+
+    q.clear();
+
+    ASSERT_EQ(0, q.count());
+    ASSERT_THROW(q.dequeue(), alg::except::BufferEmpty);
+}
+
+TEST(ExtendableQueue, LargeDataSet) {
+    constexpr int total = 100000;
+
+    alg::ds::ExtendableQueue<int> alg_queue;
+    std::deque<int> std_queue;
+    std::vector<int> batch(64);
+
+    for (int i = 0; i < total; ++i) {
+        int op = alg::randomizer::uniform_int(0, 9);
+
+        if (op < 5) {
+            alg_queue.enqueue(i);
+            std_queue.push_back(i);
+        } else if (op < 7 && !std_queue.empty()) {
+            ASSERT_EQ(std_queue.front(), alg_queue.dequeue());
+            std_queue.pop_front();
+        } else if (op < 9) {
+            int n = alg::randomizer::uniform_int(0, 63);
+
+            for (int j = 0; j < n; ++j) {
+                batch[j] = i + j;
+                std_queue.push_back(i + j);
+            }
+
+            alg_queue.enqueue_bulk(batch.begin(), n);
+        } else {
+            int n = alg::randomizer::uniform_int(0, 63);
+            std::size_t popped = alg_queue.dequeue_bulk(batch.begin(), n);
+
+            ASSERT_EQ(std::min<std::size_t>(n, std_queue.size()), popped);
+
+            for (std::size_t j = 0; j < popped; ++j) {
+                ASSERT_EQ(std_queue.front(), batch[j]);
+                std_queue.pop_front();
+            }
+        }
+
+        ASSERT_EQ(std_queue.size(), alg_queue.count());
+    }
+}
+
+}
@@ -0,0 +1,196 @@
+#include <list>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "alg/common/exception.h"
+#include "alg/common/randomizer.h"
+#include "alg/data_structure/intrusive_list.h"
+
+namespace algtest {
+
+namespace {
+
+class Connection {
+public:
+    explicit Connection(int id = 0) : id{id} {}
+
+    int id;
+
+    alg::ds::list::Hook active;
+    alg::ds::list::Hook lru;
+};
+
+using ActiveList = alg::ds::list::IntrusiveList<Connection, &Connection::active>;
+using LruList = alg::ds::list::IntrusiveList<Connection, &Connection::lru>;
+
+}
+
+TEST(IntrusiveList, Empty) {
+    ActiveList list;
+
+    ASSERT_EQ(0, list.count());
+    ASSERT_TRUE(list.begin() == list.end());
+    ASSERT_THROW(list.front(), alg::except::BufferEmpty);
+    ASSERT_THROW(list.back(), alg::except::BufferEmpty);
+    ASSERT_THROW(list.pop_front(), alg::except::BufferEmpty);
+}
+
+TEST(IntrusiveList, LinkUnlink) {
+    std::vector<Connection> connections;
+
+    for (int i = 0; i < 5; ++i) {
+        connections.emplace_back(i);
+    }
+
+    ActiveList list;
+
+    list.push_back(connections[1]);
+    list.push_back(connections[3]);
+    list.push_front(connections[0]);
+    list.insert_before(connections[3], connections[2]);
+    list.insert_after(connections[3], connections[4]);
+
+    ASSERT_THROW(list.push_back(connections[2]), alg::except::ItemExists);
+    ASSERT_EQ(5, list.count());
+
+    int expected = 0;
+
+    for (Connection& c : list) {
+        ASSERT_EQ(expected++, c.id);
+    }
+
+    ASSERT_EQ(&connections[3], list.after(connections[2]));
+    ASSERT_EQ(&connections[1], list.before(connections[2]));
+    ASSERT_EQ(nullptr, list.after(connections[4]));
+    ASSERT_EQ(nullptr, list.before(connections[0]));
+
+    list.remove(connections[2]);
+
+    ASSERT_FALSE(connections[2].active.is_linked());
+    ASSERT_THROW(list.remove(connections[2]), alg::except::ItemNotFound);
+    ASSERT_THROW(list.insert_before(connections[2], connections[2]),
+            alg::except::ItemNotFound);
+    ASSERT_THROW(list.insert_after(connections[2], connections[2]),
+            alg::except::ItemNotFound);
+    ASSERT_THROW(list.after(connections[2]), alg::except::ItemNotFound);
+    ASSERT_THROW(list.before(connections[2]), alg::except::ItemNotFound);
+    ASSERT_EQ(4, list.count());
+
+    ASSERT_EQ(0, list.pop_front().id);
+    ASSERT_EQ(4, list.pop_back().id);
+    ASSERT_EQ(1, list.front().id);
+    ASSERT_EQ(3, list.back().id);
+
+    auto it = list.end();
+
+    ASSERT_EQ(3, (--it)->id);
+    ASSERT_EQ(1, (--it)->id);
+    ASSERT_TRUE(it == list.begin());
+
+    list.clear();
+
+    ASSERT_EQ(0, list.count());
+    ASSERT_FALSE(connections[1].active.is_linked());
+}
+
+TEST(IntrusiveList, ForeignList) {
+    Connection a(0);
+    Connection b(1);
+    Connection c(2);
+
+    ActiveList lhs;
+    ActiveList rhs;
+
+    lhs.push_back(a);
+    rhs.push_back(b);
+
+    ASSERT_THROW(lhs.remove(b), alg::except::ItemNotFound);
+    ASSERT_THROW(lhs.insert_before(b, c), alg::except::ItemNotFound);
+    ASSERT_THROW(lhs.insert_after(b, c), alg::except::ItemNotFound);
+    ASSERT_THROW(lhs.after(b), alg::except::ItemNotFound);
+    ASSERT_THROW(lhs.before(b), alg::except::ItemNotFound);
+    ASSERT_THROW(lhs.push_back(b), alg::except::ItemExists);
+
+    ASSERT_FALSE(c.active.is_linked());
+    ASSERT_EQ(1, lhs.count());
+    ASSERT_EQ(1, rhs.count());
+
+    rhs.remove(b);
+    lhs.insert_after(a, b);
+
+    ASSERT_EQ(&b, lhs.after(a));
+    ASSERT_EQ(2, lhs.count());
+    ASSERT_EQ(0, rhs.count());
+}
+
+TEST(IntrusiveList, SeveralHooks) {
+    std::vector<Connection> connections;
+
+    for (int i = 0; i < 4; ++i) {
+        connections.emplace_back(i);
+    }
+
+    ActiveList active;
+    LruList lru;
+
+    for (Connection& c : connections) {
+        active.push_back(c);
+        lru.push_front(c);
+    }
+
+    lru.remove(connections[1]);
+    lru.push_front(connections[1]);
+
+    ASSERT_EQ(1, lru.front().id);
+    ASSERT_EQ(0, lru.back().id);
+
+    ASSERT_EQ(0, active.front().id);
+    ASSERT_EQ(3, active.back().id);
+
+    const ActiveList& const_active = active;
+    int sum = 0;
+
+    for (const Connection& c : const_active) {
+        sum += c.id;
+    }
+
+    ASSERT_EQ(6, sum);
+}
+
+TEST(IntrusiveList, LargeDataSet) {
+    constexpr int total = 2000;
+
+    std::vector<Connection> connections;
+    std::list<int> std_list;
+    ActiveList alg_list;
+
+    for (int i = 0; i < total; ++i) {
+        connections.emplace_back(i);
+    }
+
+    for (int round = 0; round < 20000; ++round) {
+        Connection& c = connections[alg::randomizer::uniform_int(0, total - 1)];
+
+        if (c.active.is_linked()) {
+            alg_list.remove(c);
+            std_list.remove(c.id);
+        } else if (round % 2) {
+            alg_list.push_back(c);
+            std_list.push_back(c.id);
+        } else {
+            alg_list.push_front(c);
+            std_list.push_front(c.id);
+        }
+
+        ASSERT_EQ(std_list.size(), alg_list.count());
+    }
+
+    auto it = std_list.begin();
+
+    for (const Connection& c : alg_list) {
+        ASSERT_EQ(*it++, c.id);
+    }
+}
+
+}
@@ -0,0 +1,269 @@
+#include <cstdint>
+
+#include <memory>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "alg/common/exception.h"
+#include "alg/common/randomizer.h"
+#include "alg/data_structure/leftist_heap.h"
+
+namespace algtest {
+
+namespace {
+
+struct NonNegative {
+    explicit NonNegative(int value) : value{value} {
+        if (value < 0) {
+            throw std::invalid_argument("Negative value");
+        }
+    }
+
+    int value;
+};
+
+}
+
+TEST(LeftistHeap, MinHeap) {
+    alg::ds::LeftistHeap<std::string> heap(alg::ds::PriorityQueueType::MIN);
+
+    ASSERT_EQ(0, heap.count());
+    ASSERT_THROW(heap.top(), alg::except::BufferEmpty);
+    ASSERT_THROW(heap.pop(), alg::except::BufferEmpty);
+    ASSERT_THROW(heap.top_priority(), alg::except::BufferEmpty);
+
+    heap.insert("7", 7);
+    heap.insert("0", 0);
+    heap.insert("5", 5);
+    heap.insert("2", 2);
+
+    ASSERT_EQ(4, heap.count());
+    ASSERT_EQ("0", heap.top());
+    ASSERT_EQ(0, heap.top_priority());
+    ASSERT_EQ("0", heap.pop());
+    ASSERT_EQ("2", heap.pop());
+    ASSERT_EQ("5", heap.pop());
+    ASSERT_EQ("7", heap.pop());
+    ASSERT_EQ(0, heap.count());
+
+    ASSERT_THROW(heap.pop(), alg::except::BufferEmpty);
+}
+
+TEST(LeftistHeap, MaxHeap) {
+    alg::ds::LeftistHeap<std::string> heap(alg::ds::PriorityQueueType::MAX);
+
+    heap.insert("7", 7);
+    heap.insert("0", 0);
+    heap.insert("5", 5);
+    heap.insert("2", 2);
+
+    ASSERT_EQ("7", heap.pop());
+    ASSERT_EQ("5", heap.pop());
+    ASSERT_EQ("2", heap.pop());
+    ASSERT_EQ("0", heap.pop());
+}
+
+TEST(LeftistHeap, MoveOnly) {
+    alg::ds::LeftistHeap<std::unique_ptr<int>> heap(
+            alg::ds::PriorityQueueType::MIN);
+
+    heap.insert(std::unique_ptr<int>(new int(3)), 3);
+    heap.emplace(1, new int(1));
+    heap.emplace(2, new int(2));
+
+    ASSERT_EQ(1, *heap.top());
+    ASSERT_EQ(1, *heap.pop());
+    ASSERT_EQ(2, *heap.pop());
+    ASSERT_EQ(3, *heap.pop());
+}
+
+TEST(LeftistHeap, InsertBulk) {
+    std::vector<std::pair<std::string, std::uint32_t>> items = {
+        {"4", 4}, {"1", 1}, {"8", 8}, {"3", 3}, {"6", 6}
+    };
+
+    alg::ds::LeftistHeap<std::string> heap(alg::ds::PriorityQueueType::MIN,
+            items.begin(), items.end());
+
+    heap.insert("5", 5);
+    heap.insert_bulk(items.begin(), items.begin() + 2);
+
+    ASSERT_EQ(8, heap.count());
+
+    std::vector<std::string> expected = {"1", "1", "3", "4", "4", "5", "6", "8"};
+
+    for (const std::string& s : expected) {
+        ASSERT_EQ(s, heap.pop());
+    }
+}
+
+TEST(LeftistHeap, InsertBulkThrows) {
+    std::vector<std::pair<int, std::uint32_t>> items = {
+        {4, 4}, {1, 1}, {-1, 0}, {3, 3}
+    };
+
+    alg::ds::LeftistHeap<NonNegative> heap(alg::ds::PriorityQueueType::MIN);
+
+    heap.emplace(2, 2);
+
+    ASSERT_THROW(heap.insert_bulk(items.begin(), items.end()),
+            std::invalid_argument);
+
+    ASSERT_EQ(3, heap.count());
+
+    for (int value : {1, 2, 4}) {
+        ASSERT_EQ(value, heap.pop().value);
+    }
+
+    ASSERT_EQ(0, heap.count());
+}
+
+TEST(LeftistHeap, Meld) {
+    alg::ds::LeftistHeap<int> lhs(alg::ds::PriorityQueueType::MIN);
+    alg::ds::LeftistHeap<int> rhs(alg::ds::PriorityQueueType::MIN);
+    alg::ds::LeftistHeap<int> max(alg::ds::PriorityQueueType::MAX);
+
+    for (int i = 0; i < 10; ++i) {
+        lhs.insert(2 * i, 2 * i);
+        rhs.insert(2 * i + 1, 2 * i + 1);
+    }
+
+    ASSERT_THROW(lhs.meld(max), std::invalid_argument);
+
+    lhs.meld(rhs);
+    lhs.meld(lhs);
+
+    ASSERT_EQ(20, lhs.count());
+    ASSERT_EQ(0, rhs.count());
+    ASSERT_THROW(rhs.top(), alg::except::BufferEmpty);
+
+    for (int i = 0; i < 20; ++i) {
+        ASSERT_EQ(i, lhs.pop());
+    }
+
+    rhs.insert(2, 2);
+
+    ASSERT_EQ(2, rhs.pop());
+}
+
+TEST(LeftistHeap, MeldBulk) {
+    using Heap = alg::ds::LeftistHeap<int>;
+    constexpr int heaps = 8;
+
+    std::vector<std::unique_ptr<Heap>> workers;
+    std::vector<Heap*> pointers;
+    std::multiset<int> std_set;
+
+    for (int i = 0; i < heaps; ++i) {
+        workers.emplace_back(new Heap(alg::ds::PriorityQueueType::MIN));
+        pointers.push_back(workers.back().get());
+
+        for (int j = 0; j < 100 * i; ++j) {
+            int value = alg::randomizer::uniform_int(0, 10000);
+
+            workers.back()->insert(value, value);
+            std_set.insert(value);
+        }
+    }
+
+    Heap& target = *workers[0];
+
+    target.meld_bulk(pointers.begin(), pointers.end());
+
+    ASSERT_EQ(std_set.size(), target.count());
+
+    for (int i = 1; i < heaps; ++i) {
+        ASSERT_EQ(0, workers[i]->count());
+    }
+
+    for (int value : std_set) {
+        ASSERT_EQ(value, target.pop());
+    }
+
+    Heap max(alg::ds::PriorityQueueType::MAX);
+    pointers.push_back(&max);
+
+    ASSERT_THROW(target.meld_bulk(pointers.begin(), pointers.end()),
+            std::invalid_argument);
+}
+
+TEST(LeftistHeap, MeldBulkMixedTypes) {
+    using Heap = alg::ds::LeftistHeap<int>;
+
+    Heap target(alg::ds::PriorityQueueType::MIN);
+    Heap a(alg::ds::PriorityQueueType::MIN);
+    Heap max(alg::ds::PriorityQueueType::MAX);
+    Heap b(alg::ds::PriorityQueueType::MIN);
+
+    target.insert(5, 5);
+    a.insert(3, 3);
+    a.insert(7, 7);
+    max.insert(1, 1);
+    b.insert(2, 2);
+
+    std::vector<Heap*> pointers = {&a, &max, &b};
+
+    ASSERT_THROW(target.meld_bulk(pointers.begin(), pointers.end()),
+            std::invalid_argument);
+
+    ASSERT_EQ(3, target.count());
+    ASSERT_EQ(0, a.count());
+    ASSERT_EQ(1, max.count());
+    ASSERT_EQ(1, b.count());
+
+    for (int value : {3, 5, 7}) {
+        ASSERT_EQ(value, target.pop());
+    }
+
+    ASSERT_EQ(0, target.count());
+    ASSERT_EQ(1, max.pop());
+    ASSERT_EQ(2, b.pop());
+}
+
+TEST(LeftistHeap, LargeDataSet) {
+    constexpr int total = 100000;
+    using Heap = alg::ds::LeftistHeap<int>;
+
+    Heap alg_heap(alg::ds::PriorityQueueType::MIN);
+    std::multiset<std::uint32_t> std_set;
+
+    for (int i = 0; i < total; ++i) {
+        std::uint32_t priority = alg::randomizer::uniform_int(0, 1000000);
+
+        if (i % 5) {
+            alg_heap.insert(i, priority);
+        } else {
+            Heap other(alg::ds::PriorityQueueType::MIN);
+
+            other.insert(i, priority);
+            alg_heap.meld(other);
+        }
+
+        std_set.insert(priority);
+
+        if (!(i % 3)) {
+            ASSERT_EQ(*std_set.begin(), alg_heap.top_priority());
+
+            alg_heap.pop();
+            std_set.erase(std_set.begin());
+        }
+
+        ASSERT_EQ(std_set.size(), alg_heap.count());
+    }
+
+    while (!std_set.empty()) {
+        ASSERT_EQ(*std_set.begin(), alg_heap.top_priority());
+
+        alg_heap.pop();
+        std_set.erase(std_set.begin());
+    }
+
+    ASSERT_EQ(0, alg_heap.count());
+}
+
+}
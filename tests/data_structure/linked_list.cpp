@@ -1,8 +1,18 @@
+#include <cstddef>
+
+#include <algorithm>
 #include <array>
+#include <functional>
+#include <iterator>
+#include <list>
+#include <memory>
+#include <string>
 #include <type_traits>
+#include <vector>
 
 #include <gtest/gtest.h>
 
+#include "alg/common/randomizer.h"
 #include "alg/data_structure/linked_list.h"
 
 namespace algtest {
@@ -136,6 +146,34 @@ TEST(LinkedList, Remove) {
     list.destroy_iterator(iter_backward);
 }
 
+TEST(LinkedList, PooledNodesDestroyElements) {
+    std::shared_ptr<int> tracker = std::make_shared<int>(0);
+
+    {
+        alg::ds::list::LinkedList<std::shared_ptr<int>> list;
+
+        for (int i = 0; i < 1000; ++i) {
+            list.insert_last(tracker);
+        }
+
+        ASSERT_EQ(1001, tracker.use_count());
+
+        for (int i = 0; i < 500; ++i) {
+            list.remove(list.first());
+        }
+
+        ASSERT_EQ(501, tracker.use_count());
+
+        for (int i = 0; i < 250; ++i) {
+            list.insert_first(tracker);
+        }
+
+        ASSERT_EQ(751, tracker.use_count());
+    }
+
+    ASSERT_EQ(1, tracker.use_count());
+}
+
 TEST(LinkedList, ConstCorrectness) {
     using alg::ds::list::LinkedList;
     using alg::ds::list::Node;
@@ -228,4 +266,267 @@ TEST(ListIterator, EmptyList) {
     list.destroy_iterator(iter_backward);
 }
 
+TEST(ListIterator, RangeFor) {
+    alg::ds::list::LinkedList<int> list;
+    std::array<int, 7> data = {2, 3, 5, 7, 11, 13, 17};
+
+    for (const auto& i : data) {
+        list.insert_last(i);
+    }
+
+    std::size_t i = 0;
+
+    for (int& x : list) {
+        ASSERT_EQ(data[i++], x);
+        x *= 2;
+    }
+
+    ASSERT_EQ(data.size(), i);
+    ASSERT_EQ(4, list.first()->element());
+    ASSERT_EQ(34, list.last()->element());
+}
+
+TEST(ListIterator, Bidirectional) {
+    alg::ds::list::LinkedList<int> list;
+    std::array<int, 7> data = {2, 3, 5, 7, 11, 13, 17};
+
+    for (const auto& i : data) {
+        list.insert_last(i);
+    }
+
+    ASSERT_TRUE(std::equal(data.rbegin(), data.rend(), list.rbegin()));
+    ASSERT_EQ(7, std::distance(list.begin(), list.end()));
+
+    auto it = std::find(list.begin(), list.end(), 7);
+    ASSERT_EQ(7, *it);
+    ASSERT_EQ(5, *std::prev(it));
+    ASSERT_EQ(11, *std::next(it));
+    ASSERT_EQ(17, *--list.end());
+
+    ASSERT_TRUE(std::find(list.begin(), list.end(), 4) == list.end());
+}
+
+TEST(ListIterator, ConstIteration) {
+    alg::ds::list::LinkedList<int> list;
+
+    for (int i = 0; i < 5; ++i) {
+        list.insert_last(i);
+    }
+
+    const alg::ds::list::LinkedList<int>& clist = list;
+    alg::ds::list::LinkedList<int>::const_iterator it = list.begin();
+
+    ASSERT_TRUE(it == clist.begin());
+    ASSERT_TRUE((std::is_same<const int&, decltype(*it)>::value));
+
+    int expected = 4;
+
+    for (auto rit = clist.rbegin(); rit != clist.rend(); ++rit) {
+        ASSERT_EQ(expected--, *rit);
+    }
+
+    ASSERT_EQ(-1, expected);
+}
+
+TEST(ListIterator, EmptyRange) {
+    alg::ds::list::LinkedList<int> list;
+
+    ASSERT_TRUE(list.begin() == list.end());
+    ASSERT_TRUE(list.rbegin() == list.rend());
+}
+
+TEST(LinkedList, SpliceWholeList) {
+    alg::ds::list::LinkedList<int> list;
+    std::vector<int> expected = {1, 10, 20, 30, 2};
+
+    {
+        alg::ds::list::LinkedList<int> other;
+
+        list.insert_last(1);
+        list.insert_last(2);
+
+        other.insert_last(10);
+        other.insert_last(20);
+        other.insert_last(30);
+
+        list.splice(std::next(list.begin()), other);
+
+        ASSERT_TRUE(other.begin() == other.end());
+
+        other.insert_last(40);
+        ASSERT_EQ(40, other.first()->element());
+    }
+
+    ASSERT_TRUE(std::equal(expected.begin(), expected.end(), list.begin()));
+    ASSERT_EQ(expected.size(), std::distance(list.begin(), list.end()));
+}
+
+TEST(LinkedList, SpliceRange) {
+    alg::ds::list::LinkedList<int> list;
+
+    for (int i = 0; i < 6; ++i) {
+        list.insert_last(i);
+    }
+
+    list.splice(list.begin(), list, std::next(list.begin(), 4), list.end());
+    ASSERT_EQ((std::vector<int>{4, 5, 0, 1, 2, 3}),
+            std::vector<int>(list.begin(), list.end()));
+
+    list.splice(list.end(), list, list.begin());
+    ASSERT_EQ((std::vector<int>{5, 0, 1, 2, 3, 4}),
+            std::vector<int>(list.begin(), list.end()));
+
+    list.splice(list.begin(), list, list.begin());
+    list.splice(std::next(list.begin()), list, list.begin());
+    list.splice(list.begin(), list, list.begin(), std::next(list.begin(), 2));
+    ASSERT_EQ((std::vector<int>{5, 0, 1, 2, 3, 4}),
+            std::vector<int>(list.begin(), list.end()));
+
+    alg::ds::list::LinkedList<std::string> a;
+    alg::ds::list::LinkedList<std::string> b;
+
+    a.insert_last("a");
+    b.insert_last("x");
+    b.insert_last("y");
+    b.insert_last("z");
+
+    a.splice(a.end(), b, std::next(b.begin()), b.end());
+
+    ASSERT_EQ((std::vector<std::string>{"a", "y", "z"}),
+            std::vector<std::string>(a.begin(), a.end()));
+    ASSERT_EQ((std::vector<std::string>{"x"}),
+            std::vector<std::string>(b.begin(), b.end()));
+}
+
+TEST(LinkedList, SpliceRelinksNodes) {
+    using List = alg::ds::list::LinkedList<std::string>;
+
+    std::unique_ptr<List> a(new List());
+    std::unique_ptr<List> b(new List());
+    std::unique_ptr<List> c(new List());
+
+    for (int i = 0; i < 100; ++i) {
+        b->insert_last(std::string(32, 'b') + std::to_string(i));
+        c->insert_last(std::string(32, 'c') + std::to_string(i));
+    }
+
+    c->splice(c->end(), *b, std::prev(b->end()));
+    b->splice(b->begin(), *c, std::prev(c->end()));
+
+    const std::string* moved = &*std::next(b->begin(), 10);
+    a->insert_last("a");
+    a->splice(a->end(), *b, std::next(b->begin(), 10), std::next(b->begin(), 60));
+
+    ASSERT_EQ(moved, &*std::next(a->begin()));
+    ASSERT_EQ(51, std::distance(a->begin(), a->end()));
+    ASSERT_EQ(50, std::distance(b->begin(), b->end()));
+
+    b.reset();
+
+    c->insert_last("c");
+    a->splice(a->begin(), *c, c->begin(), std::next(c->begin(), 50));
+    c->remove(c->first());
+
+    a.reset();
+
+    ASSERT_EQ(std::string(32, 'c') + "51", c->first()->element());
+    ASSERT_EQ("c", c->last()->element());
+    ASSERT_EQ(50, std::distance(c->begin(), c->end()));
+
+    for (int i = 0; i < 100; ++i) {
+        c->insert_first("x");
+        c->remove(c->last());
+    }
+
+    ASSERT_EQ("x", c->last()->element());
+}
+
+TEST(LinkedList, Merge) {
+    alg::ds::list::LinkedList<std::pair<int, int>> a;
+    alg::ds::list::LinkedList<std::pair<int, int>> b;
+
+    for (int x : {1, 3, 3, 7}) {
+        a.insert_last(std::make_pair(x, 0));
+    }
+
+    for (int x : {0, 3, 5, 8, 9}) {
+        b.insert_last(std::make_pair(x, 1));
+    }
+
+    auto by_key = [](const std::pair<int, int>& lhs,
+            const std::pair<int, int>& rhs) {
+        return lhs.first < rhs.first;
+    };
+
+    a.merge(b, by_key);
+
+    std::vector<std::pair<int, int>> expected = {
+        {0, 1}, {1, 0}, {3, 0}, {3, 0}, {3, 1}, {5, 1}, {7, 0}, {8, 1}, {9, 1}
+    };
+
+    ASSERT_TRUE(std::equal(expected.begin(), expected.end(), a.begin()));
+    ASSERT_TRUE(b.begin() == b.end());
+
+    a.merge(a, by_key);
+    ASSERT_EQ(expected.size(), std::distance(a.begin(), a.end()));
+}
+
+TEST(LinkedList, Sort) {
+    for (int n : {0, 1, 2, 3, 17, 1000}) {
+        alg::ds::list::LinkedList<int> list;
+        std::vector<int> expected;
+
+        for (int i = 0; i < n; ++i) {
+            int x = alg::randomizer::uniform_int(-100, 100);
+
+            list.insert_last(x);
+            expected.push_back(x);
+        }
+
+        std::vector<const int*> addresses;
+
+        for (const int& x : list) {
+            addresses.push_back(&x);
+        }
+
+        list.sort();
+        std::sort(expected.begin(), expected.end());
+
+        ASSERT_EQ(expected, std::vector<int>(list.begin(), list.end()));
+        ASSERT_TRUE(std::equal(expected.rbegin(), expected.rend(),
+                list.rbegin()));
+
+        for (const int& x : list) {
+            ASSERT_TRUE(std::find(addresses.begin(), addresses.end(), &x) !=
+                    addresses.end());
+        }
+
+        list.sort(std::greater<int>());
+        ASSERT_TRUE(std::equal(expected.rbegin(), expected.rend(),
+                list.begin()));
+    }
+}
+
+TEST(LinkedList, SortStable) {
+    alg::ds::list::LinkedList<std::pair<int, int>> list;
+    std::list<std::pair<int, int>> expected;
+
+    for (int i = 0; i < 500; ++i) {
+        auto item = std::make_pair(alg::randomizer::uniform_int(0, 9), i);
+
+        list.insert_last(item);
+        expected.push_back(item);
+    }
+
+    auto by_key = [](const std::pair<int, int>& lhs,
+            const std::pair<int, int>& rhs) {
+        return lhs.first < rhs.first;
+    };
+
+    list.sort(by_key);
+    expected.sort(by_key);
+
+    ASSERT_TRUE(std::equal(expected.begin(), expected.end(), list.begin()));
+}
+
 }
@@ -0,0 +1,104 @@
+#include <cstddef>
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "alg/data_structure/lock_free_stack.h"
+
+namespace algtest {
+
+TEST(LockFreeStack, PushPop) {
+    alg::ds::LockFreeStack<std::string> s;
+    std::string element;
+
+    ASSERT_EQ(0, s.count());
+    ASSERT_FALSE(s.try_pop(element));
+
+    for (int i = 0; i < 10000; ++i) {
+        s.push(std::to_string(i));
+    }
+
+    ASSERT_EQ(10000, s.count());
+
+    for (int i = 9999; i >= 5000; --i) {
+        ASSERT_TRUE(s.try_pop(element));
+        ASSERT_EQ(std::to_string(i), element);
+    }
+
+    s.emplace(3, 'x');
+
+    ASSERT_TRUE(s.try_pop(element));
+    ASSERT_EQ("xxx", element);
+    ASSERT_EQ(5000, s.count());
+}
+
+TEST(LockFreeStack, MoveOnly) {
+    alg::ds::LockFreeStack<std::unique_ptr<int>> s(0);
+    std::unique_ptr<int> element;
+
+    s.push(std::unique_ptr<int>(new int(1)));
+    s.emplace(new int(2));
+
+    ASSERT_TRUE(s.try_pop(element));
+    ASSERT_EQ(2, *element);
+    ASSERT_TRUE(s.try_pop(element));
+    ASSERT_EQ(1, *element);
+    ASSERT_FALSE(s.try_pop(element));
+
+    s.emplace(new int(3));
+}
+
+TEST(LockFreeStack, Concurrent) {
+    constexpr int threads = 4;
+    constexpr int per_thread = 50000;
+
+    alg::ds::LockFreeStack<int> s(4);
+    std::vector<std::atomic<int>> seen(threads * per_thread);
+    std::atomic<int> popped{0};
+
+    for (auto& v : seen) {
+        v.store(0);
+    }
+
+    std::vector<std::thread> workers;
+
+    for (int t = 0; t < threads; ++t) {
+        workers.emplace_back([&, t] {
+            int element;
+
+            for (int i = 0; i < per_thread; ++i) {
+                s.push(t * per_thread + i);
+
+                if (i % 2 && s.try_pop(element)) {
+                    seen[element].fetch_add(1);
+                    popped.fetch_add(1);
+                }
+            }
+        });
+    }
+
+    for (std::thread& w : workers) {
+        w.join();
+    }
+
+    int element;
+
+    while (s.try_pop(element)) {
+        seen[element].fetch_add(1);
+        popped.fetch_add(1);
+    }
+
+    ASSERT_EQ(threads * per_thread, popped.load());
+    ASSERT_EQ(0, s.count());
+
+    for (auto& v : seen) {
+        ASSERT_EQ(1, v.load());
+    }
+}
+
+}
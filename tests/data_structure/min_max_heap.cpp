@@ -0,0 +1,150 @@
+#include <algorithm>
+#include <array>
+#include <iterator>
+#include <memory>
+#include <set>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "alg/common/exception.h"
+#include "alg/common/randomizer.h"
+#include "alg/data_structure/min_max_heap.h"
+
+namespace algtest {
+
+namespace {
+
+template <class T>
+bool is_min_max_heap(const T* a, int n) {
+    for (int i = 1; i < n; ++i) {
+        for (int j = alg::ds::heap::binary::parent(i); j >= 0;
+                j = alg::ds::heap::binary::parent(j)) {
+
+            if (alg::ds::heap::minmax::is_min_level(j) ?
+                    a[i] < a[j] : a[j] < a[i]) {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+}
+
+TEST(MinMaxHeap, IsMinLevel) {
+    std::array<bool, 16> expected = {
+        true, false, false, true, true, true, true,
+        false, false, false, false, false, false, false, false, true
+    };
+
+    for (int i = 0; i < 16; ++i) {
+        ASSERT_EQ(expected[i], alg::ds::heap::minmax::is_min_level(i));
+    }
+}
+
+TEST(MinMaxHeap, BuildHeap) {
+    std::vector<int> data;
+
+    for (int n = 0; n < 200; ++n) {
+        alg::ds::heap::minmax::build_heap(data.data(), data.size());
+
+        ASSERT_TRUE(is_min_max_heap(data.data(), data.size()));
+
+        data.push_back(alg::randomizer::uniform_int(-1000, 1000));
+        std::shuffle(data.begin(), data.end(), alg::randomizer::engine());
+    }
+}
+
+TEST(MinMaxHeap, Operations) {
+    alg::ds::MinMaxHeap<std::string> heap;
+
+    ASSERT_EQ(0, heap.count());
+    ASSERT_THROW(heap.min(), alg::except::BufferEmpty);
+    ASSERT_THROW(heap.max(), alg::except::BufferEmpty);
+    ASSERT_THROW(heap.pop_min(), alg::except::BufferEmpty);
+    ASSERT_THROW(heap.pop_max(), alg::except::BufferEmpty);
+
+    heap.insert("d");
+
+    ASSERT_EQ("d", heap.min());
+    ASSERT_EQ("d", heap.max());
+
+    heap.insert("b");
+    heap.insert("f");
+    heap.insert("a");
+    heap.insert("e");
+    heap.insert("c");
+
+    ASSERT_EQ(6, heap.count());
+    ASSERT_EQ("a", heap.min());
+    ASSERT_EQ("f", heap.max());
+
+    ASSERT_EQ("f", heap.pop_max());
+    ASSERT_EQ("a", heap.pop_min());
+    ASSERT_EQ("e", heap.pop_max());
+    ASSERT_EQ("b", heap.pop_min());
+    ASSERT_EQ("d", heap.pop_max());
+    ASSERT_EQ("c", heap.pop_max());
+    ASSERT_EQ(0, heap.count());
+}
+
+TEST(MinMaxHeap, MoveOnlyElements) {
+    alg::ds::MinMaxHeap<std::unique_ptr<int>> heap;
+
+    heap.insert(std::unique_ptr<int>(new int(2)));
+    heap.insert(std::unique_ptr<int>(new int(3)));
+
+    ASSERT_EQ(2, heap.count());
+    ASSERT_TRUE(heap.pop_min());
+    ASSERT_TRUE(heap.pop_max());
+}
+
+TEST(MinMaxHeap, LargeRandomDataSet) {
+    constexpr int total = 200000;
+    std::multiset<int> std_set;
+    std::vector<int> initial;
+
+    for (int i = 0; i < 1000; ++i) {
+        initial.push_back(alg::randomizer::uniform_int(-total, total));
+        std_set.insert(initial.back());
+    }
+
+    alg::ds::MinMaxHeap<int> alg_heap(initial.begin(), initial.end());
+
+    for (int i = 0; i < total; ++i) {
+        int data = alg::randomizer::uniform_int(-total, total);
+
+        alg_heap.insert(data);
+        std_set.insert(data);
+
+        ASSERT_EQ(*std_set.begin(), alg_heap.min());
+        ASSERT_EQ(*std_set.rbegin(), alg_heap.max());
+
+        if (!(i % 3)) {
+            ASSERT_EQ(*std_set.begin(), alg_heap.pop_min());
+            std_set.erase(std_set.begin());
+        } else if (!(i % 5)) {
+            ASSERT_EQ(*std_set.rbegin(), alg_heap.pop_max());
+            std_set.erase(std::prev(std_set.end()));
+        }
+
+        ASSERT_EQ(std_set.size(), alg_heap.count());
+    }
+
+    while (!std_set.empty()) {
+        if (std_set.size() % 2) {
+            ASSERT_EQ(*std_set.begin(), alg_heap.pop_min());
+            std_set.erase(std_set.begin());
+        } else {
+            ASSERT_EQ(*std_set.rbegin(), alg_heap.pop_max());
+            std_set.erase(std::prev(std_set.end()));
+        }
+    }
+
+    ASSERT_EQ(0, alg_heap.count());
+}
+
+}
@@ -0,0 +1,135 @@
+#include <cstddef>
+
+#include <atomic>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "alg/data_structure/mpmc_queue.h"
+
+namespace algtest {
+
+TEST(MpmcQueue, Basic) {
+    ASSERT_THROW(alg::ds::MpmcQueue<int>(0), std::invalid_argument);
+    ASSERT_THROW(alg::ds::MpmcQueue<int>(
+            std::numeric_limits<std::size_t>::max()), std::invalid_argument);
+
+    alg::ds::MpmcQueue<std::string> queue(3);
+    std::string element;
+
+    ASSERT_EQ(4, queue.capacity());
+    ASSERT_EQ(2, alg::ds::MpmcQueue<int>(1).capacity());
+    ASSERT_EQ(0, queue.count());
+    ASSERT_FALSE(queue.try_dequeue(element));
+
+    ASSERT_TRUE(queue.try_enqueue("1"));
+    ASSERT_TRUE(queue.try_enqueue("2"));
+    ASSERT_TRUE(queue.try_emplace(1, '3'));
+    queue.enqueue("4");
+    ASSERT_FALSE(queue.try_enqueue("5"));
+
+    ASSERT_EQ(4, queue.count());
+
+    ASSERT_TRUE(queue.try_dequeue(element));
+    ASSERT_EQ("1", element);
+    ASSERT_EQ("2", queue.dequeue());
+    ASSERT_EQ("3", queue.dequeue());
+    ASSERT_EQ("4", queue.dequeue());
+
+    ASSERT_FALSE(queue.try_dequeue(element));
+
+    for (int i = 0; i < 10; ++i) {
+        queue.enqueue(std::to_string(i));
+        ASSERT_EQ(std::to_string(i), queue.dequeue());
+    }
+
+    queue.enqueue("left behind");
+}
+
+TEST(MpmcQueue, ThrowingConstructor) {
+    alg::ds::MpmcQueue<std::string> queue(4);
+    std::string element;
+
+    ASSERT_TRUE(queue.try_enqueue("1"));
+    ASSERT_THROW(queue.try_emplace(std::size_t(-1), 'x'), std::length_error);
+    ASSERT_TRUE(queue.try_enqueue("2"));
+
+    ASSERT_EQ("1", queue.dequeue());
+    ASSERT_EQ("2", queue.dequeue());
+    ASSERT_FALSE(queue.try_dequeue(element));
+
+    ASSERT_THROW(queue.try_emplace(std::size_t(-1), 'x'), std::length_error);
+    ASSERT_FALSE(queue.try_dequeue(element));
+
+    ASSERT_TRUE(queue.try_enqueue("3"));
+    ASSERT_THROW(queue.try_emplace(std::size_t(-1), 'x'), std::length_error);
+}
+
+TEST(MpmcQueue, MoveOnly) {
+    alg::ds::MpmcQueue<std::unique_ptr<int>> queue(2);
+    std::unique_ptr<int> element;
+
+    ASSERT_TRUE(queue.try_enqueue(std::unique_ptr<int>(new int(1))));
+    queue.enqueue(std::unique_ptr<int>(new int(2)));
+
+    ASSERT_FALSE(queue.try_enqueue(std::unique_ptr<int>(new int(3))));
+
+    ASSERT_TRUE(queue.try_dequeue(element));
+    ASSERT_EQ(1, *element);
+    ASSERT_EQ(2, *queue.dequeue());
+}
+
+TEST(MpmcQueue, ProducersConsumers) {
+    constexpr int producers = 4;
+    constexpr int consumers = 4;
+    constexpr int per_producer = 20000;
+
+    alg::ds::MpmcQueue<int> queue(64);
+    std::vector<std::atomic<int>> seen(producers * per_producer);
+    std::atomic<long long> sum{0};
+
+    for (auto& s : seen) {
+        s.store(0);
+    }
+
+    std::vector<std::thread> threads;
+
+    for (int p = 0; p < producers; ++p) {
+        threads.emplace_back([&queue, p] {
+            for (int i = 0; i < per_producer; ++i) {
+                queue.enqueue(p * per_producer + i);
+            }
+        });
+    }
+
+    for (int c = 0; c < consumers; ++c) {
+        threads.emplace_back([&] {
+            for (int i = 0; i < per_producer * producers / consumers; ++i) {
+                int element = queue.dequeue();
+
+                seen[element].fetch_add(1);
+                sum.fetch_add(element);
+            }
+        });
+    }
+
+    for (std::thread& t : threads) {
+        t.join();
+    }
+
+    long long n = producers * per_producer;
+
+    ASSERT_EQ(n * (n - 1) / 2, sum.load());
+    ASSERT_EQ(0, queue.count());
+
+    for (auto& s : seen) {
+        ASSERT_EQ(1, s.load());
+    }
+}
+
+}
@@ -0,0 +1,145 @@
+#include <cstddef>
+#include <cstdlib>
+
+#include <algorithm>
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "alg/data_structure/multi_queue.h"
+
+namespace algtest {
+
+TEST(MultiQueue, SingleLaneMinQueue) {
+    alg::ds::MultiQueue<std::string> queue(alg::ds::PriorityQueueType::MIN,
+            1, 1);
+    std::string element;
+
+    ASSERT_EQ(1, queue.lanes());
+    ASSERT_EQ(0, queue.count());
+    ASSERT_FALSE(queue.try_pop(element));
+
+    queue.push("7", 7);
+    queue.push("0", 0);
+    queue.push("5", 5);
+
+    ASSERT_EQ(3, queue.count());
+
+    ASSERT_TRUE(queue.try_pop(element));
+    ASSERT_EQ("0", element);
+    ASSERT_TRUE(queue.try_pop(element));
+    ASSERT_EQ("5", element);
+    ASSERT_TRUE(queue.try_pop(element));
+    ASSERT_EQ("7", element);
+
+    ASSERT_EQ(0, queue.count());
+    ASSERT_FALSE(queue.try_pop(element));
+}
+
+TEST(MultiQueue, SingleLaneMaxQueue) {
+    alg::ds::MultiQueue<int> queue(alg::ds::PriorityQueueType::MAX, 1, 1);
+    int element;
+
+    queue.push(7, 7);
+    queue.push(0, 0);
+    queue.push(5, 5);
+
+    ASSERT_TRUE(queue.try_pop(element));
+    ASSERT_EQ(7, element);
+    ASSERT_TRUE(queue.try_pop(element));
+    ASSERT_EQ(5, element);
+    ASSERT_TRUE(queue.try_pop(element));
+    ASSERT_EQ(0, element);
+    ASSERT_FALSE(queue.try_pop(element));
+}
+
+TEST(MultiQueue, RelaxedOrder) {
+    constexpr int total = 10000;
+    alg::ds::MultiQueue<int> queue(alg::ds::PriorityQueueType::MIN, 4);
+    std::vector<int> popped;
+    int element;
+
+    for (int i = 0; i < total; ++i) {
+        queue.push(i, i);
+    }
+
+    ASSERT_EQ(total, queue.count());
+
+    while (queue.try_pop(element)) {
+        popped.push_back(element);
+    }
+
+    ASSERT_EQ(total, popped.size());
+    ASSERT_EQ(0, queue.count());
+
+    long long displacement = 0;
+
+    for (int i = 0; i < total; ++i) {
+        displacement += std::abs(popped[i] - i);
+    }
+
+    ASSERT_LT(displacement / total, total / 10);
+
+    std::sort(popped.begin(), popped.end());
+
+    for (int i = 0; i < total; ++i) {
+        ASSERT_EQ(i, popped[i]);
+    }
+}
+
+TEST(MultiQueue, ConcurrentProducersConsumers) {
+    constexpr int threads = 8;
+    constexpr int per_thread = 20000;
+    constexpr int total = threads * per_thread;
+
+    alg::ds::MultiQueue<int> queue(alg::ds::PriorityQueueType::MIN, threads);
+    std::vector<std::vector<int>> popped(threads);
+    std::atomic<int> remaining{total};
+    std::vector<std::thread> workers;
+
+    for (int t = 0; t < threads; ++t) {
+        workers.emplace_back([&queue, &popped, &remaining, t] {
+            int element;
+
+            for (int i = 0; i < per_thread; ++i) {
+                queue.push(t * per_thread + i, i);
+
+                if (i % 2 && queue.try_pop(element)) {
+                    popped[t].push_back(element);
+                    --remaining;
+                }
+            }
+
+            while (remaining.load() > 0) {
+                if (queue.try_pop(element)) {
+                    popped[t].push_back(element);
+                    --remaining;
+                }
+            }
+        });
+    }
+
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+
+    std::vector<int> all;
+
+    for (const std::vector<int>& v : popped) {
+        all.insert(all.end(), v.begin(), v.end());
+    }
+
+    std::sort(all.begin(), all.end());
+
+    ASSERT_EQ(total, all.size());
+    ASSERT_EQ(0, queue.count());
+
+    for (int i = 0; i < total; ++i) {
+        ASSERT_EQ(i, all[i]);
+    }
+}
+
+}
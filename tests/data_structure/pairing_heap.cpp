@@ -0,0 +1,211 @@
+#include <cstdint>
+
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "alg/common/exception.h"
+#include "alg/common/randomizer.h"
+#include "alg/data_structure/pairing_heap.h"
+
+namespace algtest {
+
+TEST(PairingHeap, MinHeap) {
+    alg::ds::PairingHeap<std::string> heap(alg::ds::PriorityQueueType::MIN);
+
+    ASSERT_EQ(0, heap.count());
+    ASSERT_THROW(heap.top(), alg::except::BufferEmpty);
+    ASSERT_THROW(heap.pop(), alg::except::BufferEmpty);
+
+    heap.insert("7", 7);
+    heap.insert("0", 0);
+    heap.insert("5", 5);
+    heap.insert("2", 2);
+
+    ASSERT_EQ(4, heap.count());
+    ASSERT_EQ("0", heap.top());
+    ASSERT_EQ("0", heap.pop());
+    ASSERT_EQ("2", heap.pop());
+    ASSERT_EQ("5", heap.pop());
+    ASSERT_EQ("7", heap.pop());
+    ASSERT_EQ(0, heap.count());
+
+    ASSERT_THROW(heap.pop(), alg::except::BufferEmpty);
+}
+
+TEST(PairingHeap, MaxHeap) {
+    alg::ds::PairingHeap<std::string> heap(alg::ds::PriorityQueueType::MAX);
+
+    heap.insert("7", 7);
+    heap.insert("0", 0);
+    heap.insert("5", 5);
+    heap.insert("2", 2);
+
+    ASSERT_EQ("7", heap.pop());
+    ASSERT_EQ("5", heap.pop());
+    ASSERT_EQ("2", heap.pop());
+    ASSERT_EQ("0", heap.pop());
+}
+
+TEST(PairingHeap, UpdatePriorityAndErase) {
+    using Heap = alg::ds::PairingHeap<std::string>;
+    Heap heap(alg::ds::PriorityQueueType::MIN);
+
+    Heap::Handle h2 = heap.insert("2", 2);
+    Heap::Handle h3 = heap.insert("3", 3);
+    heap.insert("5", 5);
+    Heap::Handle h7 = heap.insert("7", 7);
+
+    heap.update_priority(h7, 1);
+
+    ASSERT_EQ("7", heap.top());
+    ASSERT_EQ(1, heap.priority(h7));
+
+    heap.update_priority(h7, 4);
+    heap.update_priority(h2, 6);
+
+    ASSERT_EQ("3", heap.top());
+
+    heap.erase(h3);
+    heap.erase(h2);
+
+    ASSERT_EQ(2, heap.count());
+    ASSERT_EQ("7", heap.pop());
+    ASSERT_EQ("5", heap.pop());
+}
+
+TEST(PairingHeap, Handles) {
+    using Heap = alg::ds::PairingHeap<std::string>;
+    Heap heap(alg::ds::PriorityQueueType::MIN);
+    Heap other(alg::ds::PriorityQueueType::MIN);
+    Heap third(alg::ds::PriorityQueueType::MIN);
+
+    Heap::Handle h1 = heap.insert("1", 1);
+    Heap::Handle h2 = heap.insert("2", 2);
+    Heap::Handle foreign = other.insert("3", 3);
+    Heap::Handle melded = third.insert("4", 4);
+
+    ASSERT_FALSE(heap.contains(Heap::Handle()));
+    ASSERT_TRUE(heap.contains(h1));
+    ASSERT_FALSE(heap.contains(foreign));
+    ASSERT_TRUE(other.contains(foreign));
+
+    ASSERT_THROW(heap.erase(foreign), alg::except::ItemNotFound);
+    ASSERT_THROW(heap.update_priority(foreign, 0), alg::except::ItemNotFound);
+    ASSERT_THROW(heap.priority(foreign), alg::except::ItemNotFound);
+
+    ASSERT_EQ("1", heap.pop());
+    ASSERT_FALSE(heap.contains(h1));
+    ASSERT_THROW(heap.erase(h1), alg::except::ItemNotFound);
+
+    Heap::Handle reused = heap.insert("5", 5);
+
+    ASSERT_TRUE(heap.contains(reused));
+    ASSERT_FALSE(heap.contains(h1));
+    ASSERT_TRUE(h1 != reused);
+
+    other.meld(third);
+    heap.meld(other);
+
+    ASSERT_TRUE(heap.contains(foreign));
+    ASSERT_TRUE(heap.contains(melded));
+    ASSERT_FALSE(other.contains(foreign));
+    ASSERT_FALSE(third.contains(melded));
+
+    heap.update_priority(melded, 0);
+    heap.erase(h2);
+
+    ASSERT_EQ(3, heap.count());
+    ASSERT_EQ("4", heap.pop());
+    ASSERT_EQ("3", heap.pop());
+    ASSERT_EQ("5", heap.pop());
+
+    Heap::Handle fresh = other.insert("6", 6);
+
+    ASSERT_TRUE(other.contains(fresh));
+    ASSERT_FALSE(heap.contains(fresh));
+}
+
+TEST(PairingHeap, Meld) {
+    alg::ds::PairingHeap<int> lhs(alg::ds::PriorityQueueType::MIN);
+    alg::ds::PairingHeap<int> rhs(alg::ds::PriorityQueueType::MIN);
+    alg::ds::PairingHeap<int> max(alg::ds::PriorityQueueType::MAX);
+
+    for (int i = 0; i < 10; ++i) {
+        lhs.insert(2 * i, 2 * i);
+        rhs.insert(2 * i + 1, 2 * i + 1);
+    }
+
+    ASSERT_THROW(lhs.meld(max), std::invalid_argument);
+
+    lhs.meld(rhs);
+
+    ASSERT_EQ(20, lhs.count());
+    ASSERT_EQ(0, rhs.count());
+    ASSERT_THROW(rhs.top(), alg::except::BufferEmpty);
+
+    for (int i = 0; i < 20; ++i) {
+        ASSERT_EQ(i, lhs.pop());
+    }
+
+    rhs.insert(2, 2);
+
+    ASSERT_EQ(2, rhs.pop());
+}
+
+TEST(PairingHeap, LargeDataSet) {
+    constexpr int total = 100000;
+    using Heap = alg::ds::PairingHeap<int>;
+
+    Heap alg_heap(alg::ds::PriorityQueueType::MIN);
+    std::set<std::pair<std::uint32_t, int>> std_set;
+    std::vector<Heap::Handle> handles(total);
+    std::vector<std::uint32_t> priorities(total);
+    std::vector<bool> alive(total, false);
+
+    for (int i = 0; i < total; ++i) {
+        priorities[i] = alg::randomizer::uniform_int(0, 1000000);
+        handles[i] = alg_heap.insert(i, priorities[i]);
+        alive[i] = true;
+        std_set.insert(std::make_pair(priorities[i], i));
+
+        int j = alg::randomizer::uniform_int(0, i);
+
+        if (alive[j]) {
+            std_set.erase(std::make_pair(priorities[j], j));
+
+            if (i % 7) {
+                priorities[j] = alg::randomizer::uniform_int(0, 1000000);
+                alg_heap.update_priority(handles[j], priorities[j]);
+                std_set.insert(std::make_pair(priorities[j], j));
+            } else {
+                alg_heap.erase(handles[j]);
+                alive[j] = false;
+            }
+        }
+
+        if (!(i % 3) && !std_set.empty()) {
+            int k = alg_heap.pop();
+
+            ASSERT_EQ(std_set.begin()->first, priorities[k]);
+
+            std_set.erase(std::make_pair(priorities[k], k));
+            alive[k] = false;
+        }
+
+        ASSERT_EQ(std_set.size(), alg_heap.count());
+    }
+
+    while (!std_set.empty()) {
+        ASSERT_EQ(std_set.begin()->first, priorities[alg_heap.pop()]);
+        std_set.erase(std_set.begin());
+    }
+
+    ASSERT_EQ(0, alg_heap.count());
+}
+
+}
@@ -1,6 +1,15 @@
+#include <cstddef>
+#include <cstdint>
+
+#include <array>
 #include <functional>
+#include <iterator>
+#include <memory>
 #include <queue>
+#include <set>
 #include <string>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 #include <gtest/gtest.h>
@@ -11,12 +20,47 @@
 
 namespace algtest {
 
+namespace {
+
+class CopyCounter {
+public:
+    static int copies;
+
+    explicit CopyCounter(int value = 0) : value{value} {}
+
+    CopyCounter(const CopyCounter& rhs) : value{rhs.value} {
+        ++copies;
+    }
+
+    CopyCounter(CopyCounter&& rhs) noexcept : value{rhs.value} {}
+
+    CopyCounter& operator=(const CopyCounter& rhs) {
+        value = rhs.value;
+        ++copies;
+
+        return *this;
+    }
+
+    CopyCounter& operator=(CopyCounter&& rhs) noexcept {
+        value = rhs.value;
+
+        return *this;
+    }
+
+    int value;
+};
+
+int CopyCounter::copies = 0;
+
+}
+
 TEST(PriorityQueue, MaxQueue) {
     alg::ds::PriorityQueue<std::string> queue(alg::ds::PriorityQueueType::MAX);
 
     ASSERT_EQ(0, queue.count());
 
     ASSERT_THROW(queue.top(), alg::except::BufferEmpty);
+    ASSERT_THROW(queue.top_priority(), alg::except::BufferEmpty);
     ASSERT_THROW(queue.pop(), alg::except::BufferEmpty);
 
     queue.insert("2", 2);
@@ -46,6 +90,7 @@ TEST(PriorityQueue, MinQueue) {
     ASSERT_EQ(0, queue.count());
 
     ASSERT_THROW(queue.top(), alg::except::BufferEmpty);
+    ASSERT_THROW(queue.top_priority(), alg::except::BufferEmpty);
     ASSERT_THROW(queue.pop(), alg::except::BufferEmpty);
 
     queue.insert("2", 2);
@@ -133,4 +178,243 @@ TEST(PriorityQueue, MinQueueLargeDataSet) {
     }
 }
 
+TEST(PriorityQueue, HandleUpdatePriority) {
+    using Queue = alg::ds::PriorityQueue<std::string>;
+    Queue queue(alg::ds::PriorityQueueType::MIN);
+
+    Queue::Handle h2 = queue.insert("2", 2);
+    Queue::Handle h7 = queue.insert("7", 7);
+    Queue::Handle h5 = queue.insert("5", 5);
+
+    ASSERT_EQ(5, queue.priority(h5));
+
+    queue.update_priority(h7, 1);
+
+    ASSERT_EQ("7", queue.top());
+    ASSERT_EQ(1, queue.top_priority());
+    ASSERT_EQ(1, queue.priority(h7));
+
+    queue.update_priority(h7, 9);
+    queue.update_priority(h2, 6);
+
+    ASSERT_EQ("5", queue.pop());
+    ASSERT_EQ("2", queue.pop());
+    ASSERT_EQ("7", queue.pop());
+
+    ASSERT_FALSE(queue.contains(h2));
+    ASSERT_THROW(queue.update_priority(h2, 0), alg::except::ItemNotFound);
+}
+
+TEST(PriorityQueue, HandleErase) {
+    using Queue = alg::ds::PriorityQueue<std::string>;
+    Queue queue(alg::ds::PriorityQueueType::MAX);
+
+    ASSERT_FALSE(queue.contains(Queue::Handle()));
+    ASSERT_THROW(queue.erase(Queue::Handle()), alg::except::ItemNotFound);
+
+    Queue::Handle h2 = queue.insert("2", 2);
+    Queue::Handle h7 = queue.insert("7", 7);
+    Queue::Handle h5 = queue.insert("5", 5);
+
+    ASSERT_TRUE(queue.contains(h2));
+    ASSERT_TRUE(queue.contains(h7));
+    ASSERT_TRUE(queue.contains(h5));
+
+    queue.erase(h7);
+
+    ASSERT_FALSE(queue.contains(h7));
+    ASSERT_THROW(queue.erase(h7), alg::except::ItemNotFound);
+    ASSERT_EQ(2, queue.count());
+    ASSERT_EQ("5", queue.top());
+
+    queue.erase(h2);
+
+    ASSERT_EQ(1, queue.count());
+    ASSERT_EQ("5", queue.pop());
+    ASSERT_FALSE(queue.contains(h5));
+}
+
+TEST(PriorityQueue, HandleLargeDataSet) {
+    constexpr int total = 100000;
+    using Queue = alg::ds::PriorityQueue<int>;
+
+    Queue alg_queue(alg::ds::PriorityQueueType::MIN);
+    std::set<std::pair<std::uint32_t, int>> std_set;
+    std::vector<Queue::Handle> handles(total);
+    std::vector<std::uint32_t> priorities(total);
+
+    for (int i = 0; i < total; ++i) {
+        priorities[i] = alg::randomizer::uniform_int(0, 1000000);
+        handles[i] = alg_queue.insert(i, priorities[i]);
+        std_set.insert(std::make_pair(priorities[i], i));
+
+        int j = alg::randomizer::uniform_int(0, i);
+
+        if (!alg_queue.contains(handles[j])) {
+            continue;
+        }
+
+        std_set.erase(std::make_pair(priorities[j], j));
+
+        if (i % 5) {
+            priorities[j] = alg::randomizer::uniform_int(0, 1000000);
+            alg_queue.update_priority(handles[j], priorities[j]);
+            std_set.insert(std::make_pair(priorities[j], j));
+        } else {
+            alg_queue.erase(handles[j]);
+        }
+
+        ASSERT_EQ(std_set.size(), alg_queue.count());
+
+        if (!std_set.empty()) {
+            ASSERT_EQ(std_set.begin()->first, alg_queue.priority(
+                    handles[alg_queue.top()]));
+        }
+    }
+
+    while (!std_set.empty()) {
+        ASSERT_EQ(std_set.begin()->first, priorities[alg_queue.pop()]);
+        std_set.erase(std_set.begin());
+    }
+
+    ASSERT_EQ(0, alg_queue.count());
+}
+
+TEST(PriorityQueue, TopReference) {
+    alg::ds::PriorityQueue<int> queue(alg::ds::PriorityQueueType::MIN);
+    const alg::ds::PriorityQueue<int>& cqueue = queue;
+
+    queue.insert(2, 2);
+    queue.top() += 11;
+
+    ASSERT_EQ(13, cqueue.top());
+
+    static_assert(std::is_same<decltype(queue.top()), int&>::value, "");
+    static_assert(std::is_same<decltype(cqueue.top()), const int&>::value, "");
+}
+
+TEST(PriorityQueue, InsertTop) {
+    alg::ds::PriorityQueue<std::string> queue(alg::ds::PriorityQueueType::MIN);
+    std::string element(32, 'x');
+
+    queue.insert(element, 0);
+
+    for (std::uint32_t i = 1; i < 40; ++i) {
+        queue.insert(queue.top(), i);
+    }
+
+    while (queue.count()) {
+        ASSERT_EQ(element, queue.pop());
+    }
+}
+
+TEST(PriorityQueue, MoveOnlyElements) {
+    alg::ds::PriorityQueue<std::unique_ptr<int>> queue(
+            alg::ds::PriorityQueueType::MAX);
+
+    queue.insert(std::unique_ptr<int>(new int(2)), 2);
+    queue.emplace(7, new int(7));
+    queue.emplace(5, new int(5));
+
+    ASSERT_EQ(7, *queue.top());
+    ASSERT_EQ(7, *queue.pop());
+    ASSERT_EQ(5, *queue.pop());
+    ASSERT_EQ(2, *queue.pop());
+    ASSERT_EQ(0, queue.count());
+}
+
+TEST(PriorityQueue, NoCopies) {
+    constexpr int total = 1000;
+    alg::ds::PriorityQueue<CopyCounter> queue(alg::ds::PriorityQueueType::MIN);
+
+    CopyCounter::copies = 0;
+
+    for (int i = 0; i < total; ++i) {
+        int data = alg::randomizer::uniform_int(0, total);
+
+        if (i % 2) {
+            queue.insert(CopyCounter(data), data);
+        } else {
+            queue.emplace(data, data);
+        }
+    }
+
+    int last = -1;
+
+    while (queue.count()) {
+        int value = queue.pop().value;
+
+        ASSERT_LE(last, value);
+        last = value;
+    }
+
+    ASSERT_EQ(0, CopyCounter::copies);
+}
+
+TEST(PriorityQueue, RangeConstructor) {
+    using Queue = alg::ds::PriorityQueue<std::string>;
+
+    std::vector<std::pair<std::string, std::uint32_t>> data = {
+        {"4", 4}, {"1", 1}, {"3", 3}, {"2", 2}, {"16", 16},
+        {"9", 9}, {"10", 10}, {"14", 14}, {"8", 8}, {"7", 7}
+    };
+
+    Queue min_queue(alg::ds::PriorityQueueType::MIN, data.begin(), data.end());
+    Queue max_queue(alg::ds::PriorityQueueType::MAX,
+            std::make_move_iterator(data.begin()),
+            std::make_move_iterator(data.end()));
+
+    ASSERT_EQ(10, min_queue.count());
+    ASSERT_EQ(10, max_queue.count());
+
+    std::array<std::string, 10> ascending = {
+        "1", "2", "3", "4", "7", "8", "9", "10", "14", "16"
+    };
+
+    for (std::size_t i = 0; i < ascending.size(); ++i) {
+        ASSERT_EQ(ascending[i], min_queue.pop());
+        ASSERT_EQ(ascending[ascending.size() - 1 - i], max_queue.pop());
+    }
+}
+
+TEST(PriorityQueue, InsertBulkLargeDataSet) {
+    constexpr int total = 100000;
+    std::priority_queue<int, std::vector<int>, std::greater<int>> std_queue;
+    alg::ds::PriorityQueue<int> alg_queue(alg::ds::PriorityQueueType::MIN);
+
+    for (int round = 0; round < 4; ++round) {
+        std::vector<std::pair<int, std::uint32_t>> batch;
+        int size = (round % 2) ? total / 100 : total;
+
+        for (int i = 0; i < size; ++i) {
+            int data = alg::randomizer::uniform_int(0, 1000000);
+
+            batch.push_back(std::make_pair(data, data));
+            std_queue.push(data);
+        }
+
+        alg_queue.insert_bulk(batch.begin(), batch.end());
+
+        ASSERT_EQ(std_queue.size(), alg_queue.count());
+
+        for (int i = 0; i < size / 2; ++i) {
+            ASSERT_EQ(std_queue.top(), alg_queue.pop());
+            std_queue.pop();
+        }
+    }
+
+    alg::ds::PriorityQueue<int>::Handle handle = alg_queue.insert(-1, 0);
+
+    ASSERT_EQ(-1, alg_queue.top());
+
+    alg_queue.erase(handle);
+
+    while (std_queue.size() > 0) {
+        ASSERT_EQ(std_queue.top(), alg_queue.pop());
+        std_queue.pop();
+    }
+
+    ASSERT_EQ(0, alg_queue.count());
+}
+
 }
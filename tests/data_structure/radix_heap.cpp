@@ -0,0 +1,96 @@
+#include <cstdint>
+
+#include <functional>
+#include <memory>
+#include <queue>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "alg/common/exception.h"
+#include "alg/common/randomizer.h"
+#include "alg/data_structure/radix_heap.h"
+
+namespace algtest {
+
+TEST(RadixHeap, Operations) {
+    alg::ds::RadixHeap<std::string> heap;
+
+    ASSERT_EQ(0, heap.count());
+    ASSERT_THROW(heap.top(), alg::except::BufferEmpty);
+    ASSERT_THROW(heap.pop(), alg::except::BufferEmpty);
+
+    heap.insert("7", 7);
+    heap.insert("0", 0);
+    heap.insert("5", 5);
+
+    ASSERT_EQ(3, heap.count());
+    ASSERT_EQ("0", heap.top());
+    ASSERT_EQ(0, heap.top_priority());
+    ASSERT_EQ("0", heap.pop());
+
+    heap.insert("2", 2);
+    heap.emplace(4294967295u, "max");
+
+    ASSERT_EQ("2", heap.pop());
+
+    ASSERT_THROW(heap.insert("1", 1), std::invalid_argument);
+
+    heap.insert("2", 2);
+
+    ASSERT_EQ("2", heap.pop());
+    ASSERT_EQ("5", heap.pop());
+    ASSERT_EQ(7, heap.top_priority());
+    ASSERT_EQ("7", heap.pop());
+    ASSERT_EQ("max", heap.pop());
+    ASSERT_EQ(0, heap.count());
+
+    ASSERT_THROW(heap.top(), alg::except::BufferEmpty);
+}
+
+TEST(RadixHeap, MoveOnlyElements) {
+    alg::ds::RadixHeap<std::unique_ptr<int>> heap;
+
+    heap.insert(std::unique_ptr<int>(new int(5)), 5);
+    heap.emplace(2, new int(2));
+
+    ASSERT_EQ(2, *heap.top());
+    ASSERT_EQ(2, *heap.pop());
+    ASSERT_EQ(5, *heap.pop());
+}
+
+TEST(RadixHeap, MonotoneLargeDataSet) {
+    constexpr int total = 500000;
+    std::priority_queue<std::uint32_t, std::vector<std::uint32_t>,
+            std::greater<std::uint32_t>> std_queue;
+    alg::ds::RadixHeap<std::uint32_t> alg_heap;
+    std::uint32_t last = 0;
+
+    for (int i = 1; i <= total; ++i) {
+        std::uint32_t data = last + alg::randomizer::uniform_int(0, 1 << 20);
+
+        std_queue.push(data);
+        alg_heap.insert(data, data);
+
+        if (!(i % 3)) {
+            last = std_queue.top();
+            std_queue.pop();
+
+            ASSERT_EQ(last, alg_heap.pop());
+        }
+
+        ASSERT_EQ(std_queue.size(), alg_heap.count());
+    }
+
+    while (std_queue.size() > 0) {
+        ASSERT_EQ(std_queue.top(), alg_heap.top_priority());
+        ASSERT_EQ(std_queue.top(), alg_heap.pop());
+        std_queue.pop();
+    }
+
+    ASSERT_EQ(0, alg_heap.count());
+}
+
+}
@@ -0,0 +1,186 @@
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "alg/common/exception.h"
+#include "alg/common/randomizer.h"
+#include "alg/data_structure/skip_list.h"
+
+namespace algtest {
+
+TEST(SkipList, Empty) {
+    alg::ds::SkipList<int> list;
+
+    ASSERT_EQ(0, list.count());
+    ASSERT_EQ(1, list.levels());
+    ASSERT_TRUE(list.begin() == list.end());
+    ASSERT_FALSE(list.contains(1));
+    ASSERT_FALSE(list.erase(1));
+    ASSERT_TRUE(list.lower_bound(1) == list.end());
+    ASSERT_THROW(list.min(), alg::except::BufferEmpty);
+    ASSERT_THROW(list.max(), alg::except::BufferEmpty);
+}
+
+TEST(SkipList, InsertErase) {
+    alg::ds::SkipList<int> list;
+
+    ASSERT_TRUE(list.insert(5));
+    ASSERT_TRUE(list.insert(1));
+    ASSERT_TRUE(list.insert(9));
+    ASSERT_FALSE(list.insert(5));
+
+    ASSERT_EQ(3, list.count());
+    ASSERT_EQ(1, list.min());
+    ASSERT_EQ(9, list.max());
+    ASSERT_EQ(5, *list.find(5));
+    ASSERT_TRUE(list.find(4) == list.end());
+
+    ASSERT_TRUE(list.erase(1));
+    ASSERT_FALSE(list.erase(1));
+    ASSERT_EQ(5, list.min());
+
+    list.clear();
+
+    ASSERT_EQ(0, list.count());
+    ASSERT_TRUE(list.begin() == list.end());
+    ASSERT_TRUE(list.insert(1));
+    ASSERT_EQ(1, list.max());
+}
+
+TEST(SkipList, RangeIteration) {
+    std::vector<int> data = {20, 0, 50, 10, 40, 30};
+    alg::ds::SkipList<int> list(data.begin(), data.end());
+
+    ASSERT_EQ((std::vector<int>{0, 10, 20, 30, 40, 50}),
+            std::vector<int>(list.begin(), list.end()));
+
+    ASSERT_EQ((std::vector<int>{10, 20, 30}),
+            std::vector<int>(list.lower_bound(10), list.upper_bound(30)));
+
+    ASSERT_EQ((std::vector<int>{20, 30}),
+            std::vector<int>(list.lower_bound(15), list.lower_bound(35)));
+
+    ASSERT_EQ(50, *list.upper_bound(40));
+    ASSERT_TRUE(list.upper_bound(50) == list.end());
+    ASSERT_EQ(0, *list.lower_bound(-5));
+}
+
+TEST(SkipList, Comparator) {
+    alg::ds::SkipList<std::string, std::greater<std::string>> list;
+
+    for (const char* s : {"pear", "apple", "fig", "kiwi"}) {
+        list.insert(s);
+    }
+
+    ASSERT_EQ((std::vector<std::string>{"pear", "kiwi", "fig", "apple"}),
+            std::vector<std::string>(list.begin(), list.end()));
+    ASSERT_EQ("pear", list.min());
+    ASSERT_EQ("apple", list.max());
+}
+
+TEST(SkipList, SortedLoad) {
+    alg::ds::SkipList<int> list;
+
+    for (int i = 0; i < 10000; ++i) {
+        ASSERT_TRUE(list.insert(i));
+    }
+
+    for (int i = -1; i > -10000; --i) {
+        ASSERT_TRUE(list.insert(i));
+    }
+
+    ASSERT_EQ(19999, list.count());
+    ASSERT_GT(list.levels(), 1);
+    ASSERT_LE(list.levels(), alg::ds::SkipList<int>::max_level);
+    ASSERT_TRUE(std::is_sorted(list.begin(), list.end()));
+
+    for (int i = 9999; i > -10000; i -= 3) {
+        ASSERT_TRUE(list.contains(i));
+        ASSERT_TRUE(list.erase(i));
+        ASSERT_FALSE(list.contains(i));
+    }
+
+    ASSERT_EQ(13332, list.count());
+}
+
+TEST(SkipList, ConcurrentReaders) {
+    constexpr int keys = 2000;
+    constexpr int readers = 4;
+
+    alg::ds::SkipList<int> list;
+
+    for (int i = 0; i < keys; ++i) {
+        list.insert(2 * i);
+    }
+
+    const alg::ds::SkipList<int>& clist = list;
+    std::vector<std::thread> threads;
+    std::vector<int> found(readers, 0);
+
+    for (int t = 0; t < readers; ++t) {
+        threads.emplace_back([&clist, &found, t] {
+            for (int i = 0; i < 2 * keys; ++i) {
+                int key = (i * 7919 + t * 104729) % (2 * keys);
+
+                if (clist.contains(key)) {
+                    ++found[t];
+                }
+
+                auto it = clist.lower_bound(key);
+                int expected = key + key % 2;
+
+                if (expected < 2 * keys ?
+                        (it == clist.end() || *it != expected) :
+                        it != clist.end()) {
+                    found[t] = -1;
+                    return;
+                }
+            }
+        });
+    }
+
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+
+    for (int t = 0; t < readers; ++t) {
+        ASSERT_EQ(keys, found[t]);
+    }
+}
+
+TEST(SkipList, Random) {
+    alg::ds::SkipList<int> list;
+    std::set<int> model;
+
+    for (int step = 0; step < 20000; ++step) {
+        int op = alg::randomizer::uniform_int(0, 3);
+        int x = alg::randomizer::uniform_int(0, 2000);
+
+        if (op < 2) {
+            ASSERT_EQ(model.insert(x).second, list.insert(x));
+        } else if (op == 2) {
+            ASSERT_EQ(model.erase(x) == 1, list.erase(x));
+        } else {
+            auto expected = model.lower_bound(x);
+            auto it = list.lower_bound(x);
+
+            if (expected == model.end()) {
+                ASSERT_TRUE(it == list.end());
+            } else {
+                ASSERT_EQ(*expected, *it);
+            }
+        }
+
+        ASSERT_EQ(model.size(), list.count());
+    }
+
+    ASSERT_TRUE(std::equal(model.begin(), model.end(), list.begin()));
+}
+
+}
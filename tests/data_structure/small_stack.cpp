@@ -0,0 +1,219 @@
+#include <memory>
+#include <stack>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#include <gtest/gtest.h>
+
+#include "alg/common/exception.h"
+#include "alg/common/randomizer.h"
+#include "alg/data_structure/small_stack.h"
+
+namespace algtest {
+
+namespace {
+
+class ThrowingCopy {
+public:
+    static int live;
+    static int copies_left;
+
+    explicit ThrowingCopy(int value) : value{value} {
+        ++live;
+    }
+
+    ThrowingCopy(const ThrowingCopy& rhs) : value{rhs.value} {
+        if (!copies_left--) {
+            throw std::runtime_error("copy");
+        }
+
+        ++live;
+    }
+
+    ~ThrowingCopy() {
+        --live;
+    }
+
+    int value;
+};
+
+int ThrowingCopy::live = 0;
+int ThrowingCopy::copies_left = 0;
+
+}
+
+TEST(SmallStack, Empty) {
+    alg::ds::SmallStack<int, 4> s;
+
+    ASSERT_EQ(0, s.count());
+    ASSERT_EQ(4, s.capacity());
+    ASSERT_TRUE(s.is_inline());
+    ASSERT_THROW(s.pop(), alg::except::BufferEmpty);
+    ASSERT_THROW(s.top(), alg::except::BufferEmpty);
+}
+
+TEST(SmallStack, SpillToHeap) {
+    alg::ds::SmallStack<std::string, 4> s;
+
+    for (int i = 0; i < 4; ++i) {
+        s.push(std::to_string(i));
+    }
+
+    ASSERT_TRUE(s.is_inline());
+
+    s.emplace(1, '4');
+
+    ASSERT_FALSE(s.is_inline());
+    ASSERT_EQ(8, s.capacity());
+
+    for (int i = 5; i < 20; ++i) {
+        s.push(std::to_string(i));
+    }
+
+    ASSERT_EQ(20, s.count());
+    ASSERT_EQ(32, s.capacity());
+
+    s.top() += "!";
+
+    ASSERT_EQ("19!", s.top());
+
+    for (int i = 19; i >= 0; --i) {
+        s.pop();
+
+        if (i) {
+            ASSERT_EQ(std::to_string(i - 1), s.top());
+        }
+    }
+
+    ASSERT_EQ(0, s.count());
+}
+
+TEST(SmallStack, PushTop) {
+    alg::ds::SmallStack<std::string, 2> s;
+    std::string element(32, 's');
+
+    s.push(element);
+
+    for (int i = 1; i < 40; ++i) {
+        s.push(s.top());
+    }
+
+    ASSERT_EQ(40, s.count());
+
+    while (s.count()) {
+        ASSERT_EQ(element, s.top());
+        s.pop();
+    }
+}
+
+TEST(SmallStack, ThrowingRelocation) {
+    {
+        alg::ds::SmallStack<ThrowingCopy, 2> s;
+
+        ThrowingCopy::copies_left = 100;
+
+        for (int i = 0; i < 4; ++i) {
+            s.emplace(i);
+        }
+
+        ASSERT_EQ(4, s.capacity());
+
+        ThrowingCopy::copies_left = 2;
+        ASSERT_THROW(s.emplace(4), std::runtime_error);
+
+        ThrowingCopy::copies_left = 2;
+        ASSERT_THROW(s.reserve(16), std::runtime_error);
+
+        ASSERT_EQ(4, s.count());
+        ASSERT_EQ(4, s.capacity());
+        ASSERT_EQ(4, ThrowingCopy::live);
+
+        for (int i = 3; i >= 0; --i) {
+            ASSERT_EQ(i, s.top().value);
+            s.pop();
+        }
+    }
+
+    ASSERT_EQ(0, ThrowingCopy::live);
+}
+
+TEST(SmallStack, MoveOnly) {
+    alg::ds::SmallStack<std::unique_ptr<int>, 2> s;
+
+    s.push(std::unique_ptr<int>(new int(0)));
+    s.emplace(new int(1));
+
+    alg::ds::SmallStack<std::unique_ptr<int>, 2> inline_moved(std::move(s));
+
+    ASSERT_EQ(0, s.count());
+    ASSERT_EQ(2, inline_moved.count());
+    ASSERT_EQ(1, *inline_moved.top());
+
+    inline_moved.emplace(new int(2));
+
+    ASSERT_FALSE(inline_moved.is_inline());
+
+    s = std::move(inline_moved);
+
+    ASSERT_EQ(0, inline_moved.count());
+    ASSERT_TRUE(inline_moved.is_inline());
+    ASSERT_FALSE(s.is_inline());
+    ASSERT_EQ(3, s.count());
+
+    for (int i = 2; i >= 0; --i) {
+        ASSERT_EQ(i, *s.top());
+        s.pop();
+    }
+}
+
+TEST(SmallStack, Copy) {
+    alg::ds::SmallStack<std::string, 2> small;
+    alg::ds::SmallStack<std::string, 2> large;
+
+    small.push("a");
+
+    for (int i = 0; i < 10; ++i) {
+        large.push(std::to_string(i));
+    }
+
+    alg::ds::SmallStack<std::string, 2> copy(large);
+
+    ASSERT_EQ(10, copy.count());
+    ASSERT_EQ("9", copy.top());
+
+    copy = small;
+
+    ASSERT_EQ(1, copy.count());
+    ASSERT_EQ("a", copy.top());
+
+    small = large;
+    large.clear();
+
+    ASSERT_EQ(10, small.count());
+    ASSERT_EQ(0, large.count());
+    ASSERT_EQ("9", small.top());
+}
+
+TEST(SmallStack, LargeDataSet) {
+    constexpr int total = 100000;
+
+    alg::ds::SmallStack<int, 8> alg_stack;
+    std::stack<int> std_stack;
+
+    for (int i = 0; i < total; ++i) {
+        if (alg::randomizer::uniform_int(0, 2) || std_stack.empty()) {
+            alg_stack.push(i);
+            std_stack.push(i);
+        } else {
+            ASSERT_EQ(std_stack.top(), alg_stack.top());
+
+            alg_stack.pop();
+            std_stack.pop();
+        }
+
+        ASSERT_EQ(std_stack.size(), alg_stack.count());
+    }
+}
+
+}
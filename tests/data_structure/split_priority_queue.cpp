@@ -0,0 +1,301 @@
+#include <cstdint>
+
+#include <array>
+#include <functional>
+#include <memory>
+#include <queue>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "alg/common/exception.h"
+#include "alg/common/randomizer.h"
+#include "alg/data_structure/split_priority_queue.h"
+
+namespace algtest {
+
+namespace {
+
+class Tracked {
+public:
+    static int live;
+
+    explicit Tracked(int value) : value{value} {
+        if (value < 0) {
+            throw std::invalid_argument("Negative value");
+        }
+
+        ++live;
+    }
+
+    Tracked(Tracked&& rhs) : value{rhs.value} {
+        ++live;
+    }
+
+    Tracked& operator=(const Tracked&) = delete;
+    Tracked& operator=(Tracked&&) = delete;
+
+    ~Tracked() {
+        --live;
+    }
+
+    const int value;
+};
+
+int Tracked::live = 0;
+
+}
+
+TEST(SplitPriorityQueue, MaxQueue) {
+    alg::ds::SplitPriorityQueue<std::string> queue(
+            alg::ds::PriorityQueueType::MAX);
+
+    ASSERT_EQ(0, queue.count());
+
+    ASSERT_THROW(queue.top(), alg::except::BufferEmpty);
+    ASSERT_THROW(queue.top_priority(), alg::except::BufferEmpty);
+    ASSERT_THROW(queue.pop(), alg::except::BufferEmpty);
+
+    queue.insert("7", 7);
+    queue.insert("0", 0);
+    queue.insert("5", 5);
+
+    ASSERT_EQ(3, queue.count());
+    ASSERT_EQ("7", queue.top());
+    ASSERT_EQ(7, queue.top_priority());
+    ASSERT_EQ("7", queue.pop());
+    ASSERT_EQ("5", queue.pop());
+    ASSERT_EQ("0", queue.pop());
+    ASSERT_EQ(0, queue.count());
+}
+
+TEST(SplitPriorityQueue, MinQueue) {
+    alg::ds::SplitPriorityQueue<std::string> queue(
+            alg::ds::PriorityQueueType::MIN);
+
+    queue.insert("7", 7);
+    queue.insert("0", 0);
+    queue.insert("5", 5);
+
+    ASSERT_EQ("0", queue.pop());
+    ASSERT_EQ("5", queue.pop());
+    ASSERT_EQ("7", queue.pop());
+
+    ASSERT_THROW(queue.pop(), alg::except::BufferEmpty);
+}
+
+TEST(SplitPriorityQueue, Handles) {
+    using Queue = alg::ds::SplitPriorityQueue<std::string>;
+    Queue queue(alg::ds::PriorityQueueType::MIN);
+
+    Queue::Handle h2 = queue.insert("2", 2);
+    Queue::Handle h7 = queue.insert("7", 7);
+    Queue::Handle h5 = queue.insert("5", 5);
+
+    queue.update_priority(h7, 1);
+
+    ASSERT_EQ("7", queue.top());
+    ASSERT_EQ(1, queue.priority(h7));
+
+    queue.update_priority(h7, 9);
+    queue.erase(h5);
+
+    ASSERT_FALSE(queue.contains(h5));
+    ASSERT_THROW(queue.erase(h5), alg::except::ItemNotFound);
+
+    Queue::Handle h3 = queue.insert("3", 3);
+
+    ASSERT_NE(h5, h3);
+    ASSERT_FALSE(queue.contains(h5));
+    ASSERT_TRUE(queue.contains(h3));
+
+    ASSERT_EQ("2", queue.pop());
+    ASSERT_EQ("3", queue.pop());
+    ASSERT_EQ("7", queue.pop());
+
+    ASSERT_FALSE(queue.contains(h2));
+}
+
+TEST(SplitPriorityQueue, EraseReleasesElement) {
+    using Queue = alg::ds::SplitPriorityQueue<std::shared_ptr<int>>;
+    Queue queue(alg::ds::PriorityQueueType::MIN);
+    std::shared_ptr<int> element = std::make_shared<int>(1);
+
+    Queue::Handle handle = queue.insert(element, 1);
+    queue.insert(std::make_shared<int>(2), 2);
+
+    ASSERT_EQ(2, element.use_count());
+
+    queue.erase(handle);
+
+    ASSERT_EQ(1, element.use_count());
+    ASSERT_EQ(2, *queue.top());
+}
+
+TEST(SplitPriorityQueue, ReusedIdsConstructInPlace) {
+    using Queue = alg::ds::SplitPriorityQueue<Tracked>;
+
+    {
+        Queue queue(alg::ds::PriorityQueueType::MIN);
+        std::vector<Queue::Handle> handles;
+
+        for (int i = 0; i < 8; ++i) {
+            handles.push_back(queue.emplace(i, i));
+        }
+
+        ASSERT_EQ(8, Tracked::live);
+
+        queue.erase(handles[3]);
+        ASSERT_EQ(0, queue.pop().value);
+
+        ASSERT_EQ(6, Tracked::live);
+
+        queue.emplace(3, 30);
+        ASSERT_THROW(queue.emplace(0, -1), std::invalid_argument);
+
+        ASSERT_EQ(7, Tracked::live);
+        ASSERT_EQ(7, queue.count());
+        ASSERT_EQ(1, queue.top().value);
+
+        queue.emplace(0, 0);
+
+        for (int value : {0, 1, 2, 30, 4, 5, 6, 7}) {
+            ASSERT_EQ(value, queue.pop().value);
+        }
+
+        ASSERT_EQ(0, Tracked::live);
+
+        queue.emplace(9, 9);
+    }
+
+    ASSERT_EQ(0, Tracked::live);
+}
+
+TEST(SplitPriorityQueue, InsertTop) {
+    using Queue = alg::ds::SplitPriorityQueue<std::string>;
+    Queue queue(alg::ds::PriorityQueueType::MIN);
+    std::string element(32, 'x');
+
+    queue.insert(element, 0);
+
+    for (std::uint32_t i = 1; i < 40; ++i) {
+        queue.insert(queue.top(), i);
+    }
+
+    while (queue.count()) {
+        ASSERT_EQ(element, queue.pop());
+    }
+}
+
+TEST(SplitPriorityQueue, MoveOnlyElements) {
+    alg::ds::SplitPriorityQueue<std::unique_ptr<int>> queue(
+            alg::ds::PriorityQueueType::MAX);
+
+    queue.insert(std::unique_ptr<int>(new int(2)), 2);
+    queue.emplace(7, new int(7));
+    queue.emplace(5, new int(5));
+
+    ASSERT_EQ(7, *queue.pop());
+
+    queue.emplace(3, new int(3));
+
+    ASSERT_EQ(5, *queue.pop());
+    ASSERT_EQ(3, *queue.pop());
+    ASSERT_EQ(2, *queue.pop());
+}
+
+TEST(SplitPriorityQueue, RangeConstructor) {
+    std::vector<std::pair<std::string, std::uint32_t>> data = {
+        {"4", 4}, {"1", 1}, {"3", 3}, {"2", 2}, {"16", 16},
+        {"9", 9}, {"10", 10}, {"14", 14}, {"8", 8}, {"7", 7}
+    };
+
+    alg::ds::SplitPriorityQueue<std::string> queue(
+            alg::ds::PriorityQueueType::MIN, data.begin(), data.end());
+
+    std::array<std::string, 10> expected = {
+        "1", "2", "3", "4", "7", "8", "9", "10", "14", "16"
+    };
+
+    ASSERT_EQ(10, queue.count());
+
+    for (const std::string& element : expected) {
+        ASSERT_EQ(element, queue.pop());
+    }
+}
+
+TEST(SplitPriorityQueue, LargeDataSet) {
+    constexpr int total = 100000;
+    using Queue = alg::ds::SplitPriorityQueue<int>;
+
+    Queue alg_queue(alg::ds::PriorityQueueType::MIN);
+    std::set<std::pair<std::uint32_t, int>> std_set;
+    std::vector<Queue::Handle> handles(total);
+    std::vector<std::uint32_t> priorities(total);
+
+    std::vector<std::pair<int, std::uint32_t>> batch;
+
+    for (int i = 0; i < total / 2; ++i) {
+        priorities[i] = alg::randomizer::uniform_int(0, 1000000);
+        batch.push_back(std::make_pair(-1, priorities[i]));
+        std_set.insert(std::make_pair(priorities[i], -1 - i));
+    }
+
+    alg_queue.insert_bulk(batch.begin(), batch.end());
+
+    for (int i = 0; i < total; ++i) {
+        priorities[i] = alg::randomizer::uniform_int(0, 1000000);
+        handles[i] = alg_queue.insert(i, priorities[i]);
+        std_set.insert(std::make_pair(priorities[i], i));
+
+        int j = alg::randomizer::uniform_int(0, i);
+
+        if (alg_queue.contains(handles[j])) {
+            std_set.erase(std::make_pair(priorities[j], j));
+
+            if (i % 5) {
+                priorities[j] = alg::randomizer::uniform_int(0, 1000000);
+                alg_queue.update_priority(handles[j], priorities[j]);
+                std_set.insert(std::make_pair(priorities[j], j));
+            } else {
+                alg_queue.erase(handles[j]);
+            }
+        }
+
+        if (!(i % 3)) {
+            std::uint32_t top = alg_queue.top_priority();
+
+            ASSERT_EQ(std_set.begin()->first, top);
+
+            int k = alg_queue.pop();
+
+            if (k >= 0) {
+                ASSERT_EQ(1, std_set.erase(std::make_pair(top, k)));
+            } else {
+                auto it = std_set.lower_bound(std::make_pair(top, -total));
+
+                ASSERT_EQ(top, it->first);
+                ASSERT_GT(0, it->second);
+
+                std_set.erase(it);
+            }
+        }
+
+        ASSERT_EQ(std_set.size(), alg_queue.count());
+    }
+
+    while (!std_set.empty()) {
+        ASSERT_EQ(std_set.begin()->first, alg_queue.top_priority());
+
+        alg_queue.pop();
+        std_set.erase(std_set.begin());
+    }
+
+    ASSERT_EQ(0, alg_queue.count());
+}
+
+}
@@ -0,0 +1,175 @@
+#include <cstddef>
+
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "alg/data_structure/spsc_queue.h"
+
+namespace algtest {
+
+namespace {
+
+struct NonNegative {
+    explicit NonNegative(int value) : value{value} {
+        if (value < 0) {
+            throw std::invalid_argument("Negative value");
+        }
+    }
+
+    int value;
+};
+
+}
+
+TEST(SpscQueue, Basic) {
+    ASSERT_THROW(alg::ds::SpscQueue<int>(0), std::invalid_argument);
+    ASSERT_THROW(alg::ds::SpscQueue<int>(
+            std::numeric_limits<std::size_t>::max()), std::invalid_argument);
+
+    alg::ds::SpscQueue<std::string> queue(3);
+    std::string element;
+
+    ASSERT_EQ(4, queue.capacity());
+    ASSERT_EQ(0, queue.count());
+    ASSERT_FALSE(queue.try_pop(element));
+
+    ASSERT_TRUE(queue.try_push("1"));
+    ASSERT_TRUE(queue.try_push("2"));
+    ASSERT_TRUE(queue.try_emplace(1, '3'));
+    ASSERT_TRUE(queue.try_push("4"));
+    ASSERT_FALSE(queue.try_push("5"));
+
+    ASSERT_EQ(4, queue.count());
+
+    for (int i = 1; i <= 4; ++i) {
+        ASSERT_TRUE(queue.try_pop(element));
+        ASSERT_EQ(std::to_string(i), element);
+    }
+
+    ASSERT_FALSE(queue.try_pop(element));
+
+    for (int i = 0; i < 10; ++i) {
+        ASSERT_TRUE(queue.try_push(std::to_string(i)));
+        ASSERT_TRUE(queue.try_pop(element));
+        ASSERT_EQ(std::to_string(i), element);
+    }
+
+    queue.try_push("left behind");
+}
+
+TEST(SpscQueue, MoveOnly) {
+    alg::ds::SpscQueue<std::unique_ptr<int>> queue(2);
+    std::unique_ptr<int> element;
+
+    ASSERT_TRUE(queue.try_push(std::unique_ptr<int>(new int(1))));
+    ASSERT_TRUE(queue.try_emplace(new int(2)));
+
+    ASSERT_TRUE(queue.try_pop(element));
+    ASSERT_EQ(1, *element);
+    ASSERT_TRUE(queue.try_pop(element));
+    ASSERT_EQ(2, *element);
+}
+
+TEST(SpscQueue, Bulk) {
+    alg::ds::SpscQueue<int> queue(8);
+    std::vector<int> input = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+    std::vector<int> output(10, -1);
+
+    ASSERT_EQ(5, queue.push_bulk(input.begin(), input.begin() + 5));
+    ASSERT_EQ(3, queue.pop_bulk(output.begin(), 3));
+    ASSERT_EQ(5, queue.push_bulk(input.begin() + 5, input.end()));
+    ASSERT_EQ(7, queue.pop_bulk(output.begin() + 3, 10));
+    ASSERT_EQ(0, queue.pop_bulk(output.begin(), 10));
+
+    ASSERT_EQ(input, output);
+
+    ASSERT_EQ(8, queue.push_bulk(input.begin(), input.end()));
+    ASSERT_EQ(0, queue.push_bulk(input.begin(), input.end()));
+    ASSERT_EQ(8, queue.count());
+}
+
+TEST(SpscQueue, BulkThrows) {
+    alg::ds::SpscQueue<NonNegative> queue(8);
+    std::vector<int> input = {0, 1, -1, 3};
+
+    ASSERT_THROW(queue.push_bulk(input.begin(), input.end()),
+            std::invalid_argument);
+    ASSERT_EQ(2, queue.count());
+
+    std::vector<NonNegative> output;
+
+    ASSERT_EQ(2, queue.pop_bulk(std::back_inserter(output), 4));
+    ASSERT_EQ(0, output[0].value);
+    ASSERT_EQ(1, output[1].value);
+}
+
+TEST(SpscQueue, ProducerConsumer) {
+    constexpr std::size_t total = 200000;
+
+    alg::ds::SpscQueue<std::size_t> queue(1024);
+    std::size_t mismatches = 0;
+
+    std::thread consumer([&] {
+        std::size_t expected = 0;
+        std::size_t batch[32];
+
+        while (expected < total) {
+            std::size_t element;
+
+            if (expected % 2) {
+                std::size_t n = queue.pop_bulk(batch, 32);
+
+                if (!n) {
+                    std::this_thread::yield();
+                }
+
+                for (std::size_t i = 0; i < n; ++i) {
+                    mismatches += batch[i] != expected++;
+                }
+            } else if (queue.try_pop(element)) {
+                mismatches += element != expected++;
+            } else {
+                std::this_thread::yield();
+            }
+        }
+    });
+
+    std::size_t next = 0;
+
+    while (next < total) {
+        if (next % 3) {
+            std::size_t batch[16];
+            std::size_t n = 0;
+
+            for ( ; n < 16 && next + n < total; ++n) {
+                batch[n] = next + n;
+            }
+
+            std::size_t pushed = queue.push_bulk(batch, batch + n);
+
+            if (!pushed) {
+                std::this_thread::yield();
+            }
+
+            next += pushed;
+        } else if (queue.try_push(next)) {
+            ++next;
+        } else {
+            std::this_thread::yield();
+        }
+    }
+
+    consumer.join();
+
+    ASSERT_EQ(0, mismatches);
+    ASSERT_EQ(0, queue.count());
+}
+
+}
@@ -0,0 +1,232 @@
+#include <cstdint>
+
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "alg/common/exception.h"
+#include "alg/common/randomizer.h"
+#include "alg/data_structure/timing_wheel.h"
+
+namespace algtest {
+
+TEST(TimingWheel, FireInOrder) {
+    alg::ds::TimingWheel<std::string> wheel;
+    std::vector<std::string> fired;
+
+    auto collect = [&fired](std::string& element) {
+        fired.push_back(element);
+    };
+
+    ASSERT_EQ(0, wheel.now());
+    ASSERT_EQ(0, wheel.count());
+
+    wheel.schedule("7", 7);
+    wheel.schedule("2", 2);
+    wheel.schedule("5", 5);
+    wheel.schedule("300", 300);
+
+    ASSERT_EQ(4, wheel.count());
+    ASSERT_EQ(0, wheel.advance(1, collect));
+    ASSERT_EQ(2, wheel.advance(5, collect));
+    ASSERT_EQ(5, wheel.now());
+
+    ASSERT_EQ((std::vector<std::string>{"2", "5"}), fired);
+
+    ASSERT_EQ(1, wheel.advance(299, collect));
+    ASSERT_EQ(1, wheel.advance(300, collect));
+    ASSERT_EQ(0, wheel.count());
+
+    ASSERT_EQ((std::vector<std::string>{"2", "5", "7", "300"}), fired);
+}
+
+TEST(TimingWheel, Cancel) {
+    using Wheel = alg::ds::TimingWheel<int>;
+    Wheel wheel(100);
+    int fired = 0;
+
+    auto count = [&fired](int&) {
+        ++fired;
+    };
+
+    Wheel::Handle h1 = wheel.schedule(1, 110);
+    Wheel::Handle h2 = wheel.schedule(2, 100000);
+
+    ASSERT_TRUE(wheel.contains(h1));
+    ASSERT_EQ(100000, wheel.expires(h2));
+
+    wheel.cancel(h2);
+
+    ASSERT_FALSE(wheel.contains(h2));
+    ASSERT_THROW(wheel.cancel(h2), alg::except::ItemNotFound);
+    ASSERT_THROW(wheel.cancel(Wheel::Handle()), alg::except::ItemNotFound);
+
+    Wheel::Handle h3 = wheel.schedule(3, 120);
+
+    ASSERT_NE(h2, h3);
+    ASSERT_FALSE(wheel.contains(h2));
+
+    ASSERT_EQ(2, wheel.advance(200000, count));
+    ASSERT_EQ(2, fired);
+    ASSERT_FALSE(wheel.contains(h1));
+    ASSERT_FALSE(wheel.contains(h3));
+}
+
+TEST(TimingWheel, PastAndReentrant) {
+    alg::ds::TimingWheel<int> wheel(1000);
+    std::vector<std::pair<int, std::uint32_t>> fired;
+
+    wheel.schedule(1, 10);
+
+    auto callback = [&wheel, &fired](int& element) {
+        fired.push_back(std::make_pair(element, wheel.now()));
+
+        if (element < 3) {
+            wheel.schedule(element + 1, wheel.now());
+        }
+    };
+
+    ASSERT_EQ(3, wheel.advance(1001, callback));
+
+    std::vector<std::pair<int, std::uint32_t>> expected = {
+        {1, 1001}, {2, 1001}, {3, 1001}
+    };
+
+    ASSERT_EQ(expected, fired);
+}
+
+TEST(TimingWheel, WrapAround) {
+    alg::ds::TimingWheel<int> wheel(4294967000u);
+    std::vector<int> fired;
+
+    wheel.schedule(1, 4294967295u);
+    wheel.schedule(2, 500);
+
+    auto collect = [&fired](int& element) {
+        fired.push_back(element);
+    };
+
+    wheel.advance(4294967295u, collect);
+
+    ASSERT_EQ(std::vector<int>{1}, fired);
+
+    wheel.advance(500, collect);
+
+    ASSERT_EQ((std::vector<int>{1, 2}), fired);
+}
+
+TEST(TimingWheel, MaxDelay) {
+    using Wheel = alg::ds::TimingWheel<int>;
+    Wheel wheel(100);
+    std::vector<int> fired;
+
+    auto collect = [&fired](int& element) {
+        fired.push_back(element);
+    };
+
+    wheel.schedule(1, 100 + Wheel::max_delay);
+    wheel.schedule(2, 100 + Wheel::max_delay + 2);
+
+    ASSERT_EQ(1, wheel.advance(101, collect));
+    ASSERT_EQ(std::vector<int>{2}, fired);
+    ASSERT_EQ(1, wheel.count());
+}
+
+TEST(TimingWheel, ReleasePayload) {
+    using Wheel = alg::ds::TimingWheel<std::shared_ptr<int>>;
+    Wheel wheel;
+    std::shared_ptr<int> payload = std::make_shared<int>(7);
+
+    Wheel::Handle h1 = wheel.schedule(payload, 10);
+    wheel.schedule(payload, 20);
+
+    ASSERT_EQ(3, payload.use_count());
+
+    wheel.cancel(h1);
+
+    ASSERT_EQ(2, payload.use_count());
+
+    wheel.advance(20, [](std::shared_ptr<int>& element) {
+        ASSERT_EQ(7, *element);
+    });
+
+    ASSERT_EQ(1, payload.use_count());
+
+    wheel.schedule(payload, 30);
+    wheel.schedule(std::make_shared<int>(8), 40);
+
+    ASSERT_EQ(2, payload.use_count());
+}
+
+TEST(TimingWheel, LargeRandomDataSet) {
+    constexpr int total = 200000;
+    using Wheel = alg::ds::TimingWheel<int>;
+
+    Wheel wheel;
+    std::multimap<std::uint32_t, int> expected;
+    std::vector<Wheel::Handle> handles(total);
+    std::vector<std::uint32_t> deadlines(total);
+    std::uint32_t now = 0;
+
+    auto check = [&expected, &deadlines, &now](int& element) {
+        ASSERT_LE(deadlines[element], now);
+        ASSERT_GE(deadlines[element] + 1, expected.begin()->first);
+
+        auto range = expected.equal_range(deadlines[element]);
+        bool found = false;
+
+        for (auto it = range.first; it != range.second; ++it) {
+            if (it->second == element) {
+                expected.erase(it);
+                found = true;
+                break;
+            }
+        }
+
+        ASSERT_TRUE(found);
+    };
+
+    for (int i = 0; i < total; ++i) {
+        std::uint32_t delay = (i % 10) ?
+                alg::randomizer::uniform_int(0, 1000) :
+                alg::randomizer::uniform_int(0, 1 << 22);
+
+        deadlines[i] = now + delay;
+        handles[i] = wheel.schedule(i, deadlines[i]);
+        expected.insert(std::make_pair(deadlines[i], i));
+
+        int j = alg::randomizer::uniform_int(0, i);
+
+        if (!(i % 4) && wheel.contains(handles[j])) {
+            wheel.cancel(handles[j]);
+
+            auto range = expected.equal_range(deadlines[j]);
+
+            for (auto it = range.first; it != range.second; ++it) {
+                if (it->second == j) {
+                    expected.erase(it);
+                    break;
+                }
+            }
+        }
+
+        if (!(i % 16)) {
+            now += alg::randomizer::uniform_int(0, 64);
+            wheel.advance(now, check);
+        }
+
+        ASSERT_EQ(expected.size(), wheel.count());
+    }
+
+    now += 1 << 22;
+    wheel.advance(now, check);
+
+    ASSERT_TRUE(expected.empty());
+    ASSERT_EQ(0, wheel.count());
+}
+
+}
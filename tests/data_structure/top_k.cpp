@@ -0,0 +1,127 @@
+#include <algorithm>
+#include <functional>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "alg/common/exception.h"
+#include "alg/common/randomizer.h"
+#include "alg/data_structure/top_k.h"
+
+namespace algtest {
+
+TEST(TopK, Basic) {
+    ASSERT_THROW(alg::ds::TopK<int>(0), std::invalid_argument);
+
+    alg::ds::TopK<int> top(3);
+
+    ASSERT_EQ(3, top.k());
+    ASSERT_EQ(0, top.count());
+    ASSERT_THROW(top.min(), alg::except::BufferEmpty);
+
+    ASSERT_TRUE(top.offer(5));
+    ASSERT_TRUE(top.offer(1));
+    ASSERT_TRUE(top.offer(7));
+
+    ASSERT_EQ(1, top.min());
+
+    ASSERT_FALSE(top.offer(0));
+    ASSERT_FALSE(top.offer(1));
+    ASSERT_TRUE(top.offer(6));
+
+    ASSERT_EQ(3, top.count());
+    ASSERT_EQ(5, top.min());
+
+    alg::ds::ExtendableArray<int> result = top.extract();
+
+    ASSERT_EQ(3, result.count());
+    ASSERT_EQ(7, result[0]);
+    ASSERT_EQ(6, result[1]);
+    ASSERT_EQ(5, result[2]);
+
+    ASSERT_EQ(0, top.count());
+    ASSERT_TRUE(top.offer(2));
+    ASSERT_EQ(2, top.min());
+}
+
+TEST(TopK, MovedRange) {
+    alg::ds::TopK<std::string> top(2);
+    std::string words[] = {"b", "d", "a", "c"};
+
+    ASSERT_EQ(3, top.offer_bulk(std::make_move_iterator(words),
+            std::make_move_iterator(words + 4)));
+
+    alg::ds::ExtendableArray<std::string> result = top.extract();
+
+    ASSERT_EQ("d", result[0]);
+    ASSERT_EQ("c", result[1]);
+}
+
+TEST(TopK, Merge) {
+    alg::ds::TopK<int> lhs(4);
+    alg::ds::TopK<int> rhs(4);
+
+    for (int i = 0; i < 10; ++i) {
+        lhs.offer(2 * i);
+        rhs.offer(2 * i + 1);
+    }
+
+    lhs.merge(lhs);
+    lhs.merge(static_cast<const alg::ds::TopK<int>&>(rhs));
+
+    ASSERT_EQ(4, rhs.count());
+    ASSERT_EQ(16, lhs.min());
+
+    alg::ds::TopK<int> other(2);
+
+    other.offer(100);
+    lhs.merge(std::move(other));
+
+    ASSERT_EQ(0, other.count());
+
+    alg::ds::ExtendableArray<int> result = lhs.extract();
+    std::vector<int> expected = {100, 19, 18, 17};
+
+    for (std::size_t i = 0; i < expected.size(); ++i) {
+        ASSERT_EQ(expected[i], result[i]);
+    }
+}
+
+TEST(TopK, LargeDataSet) {
+    constexpr int total = 200000;
+    constexpr int k = 100;
+    constexpr int workers = 4;
+
+    std::vector<int> values(total);
+    std::vector<alg::ds::TopK<int>> partial(workers, alg::ds::TopK<int>(k));
+
+    for (int& value : values) {
+        value = alg::randomizer::uniform_int(0, 1000000);
+    }
+
+    int chunk = total / workers;
+
+    for (int w = 0; w < workers; ++w) {
+        partial[w].offer_bulk(values.begin() + w * chunk,
+                values.begin() + (w + 1) * chunk);
+    }
+
+    for (int w = 1; w < workers; ++w) {
+        partial[0].merge(std::move(partial[w]));
+    }
+
+    alg::ds::ExtendableArray<int> result = partial[0].extract();
+
+    std::sort(values.begin(), values.end(), std::greater<int>());
+
+    ASSERT_EQ(k, result.count());
+
+    for (int i = 0; i < k; ++i) {
+        ASSERT_EQ(values[i], result[i]);
+    }
+}
+
+}
@@ -0,0 +1,203 @@
+#include <algorithm>
+#include <iterator>
+#include <list>
+#include <memory>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "alg/common/exception.h"
+#include "alg/common/randomizer.h"
+#include "alg/data_structure/unrolled_list.h"
+
+namespace algtest {
+
+TEST(UnrolledList, Empty) {
+    alg::ds::list::UnrolledList<int> list;
+
+    ASSERT_EQ(0, list.count());
+    ASSERT_TRUE(list.begin() == list.end());
+    ASSERT_THROW(list.front(), alg::except::BufferEmpty);
+    ASSERT_THROW(list.back(), alg::except::BufferEmpty);
+    ASSERT_THROW(list.pop_front(), alg::except::BufferEmpty);
+    ASSERT_THROW(list.pop_back(), alg::except::BufferEmpty);
+    ASSERT_THROW(list.erase(list.end()), alg::except::ItemNotFound);
+}
+
+TEST(UnrolledList, NodeCapacity) {
+    ASSERT_EQ(64, alg::ds::list::unrolled_node_capacity<char>());
+    ASSERT_EQ(64, alg::ds::list::unrolled_node_capacity<int>());
+    ASSERT_EQ(32, alg::ds::list::unrolled_node_capacity<double>());
+    ASSERT_EQ(8, alg::ds::list::unrolled_node_capacity<char[128]>());
+}
+
+TEST(UnrolledList, PushPop) {
+    alg::ds::list::UnrolledList<int, 4> list;
+
+    for (int i = 0; i < 20; ++i) {
+        list.push_back(i);
+        list.push_front(-i - 1);
+    }
+
+    ASSERT_EQ(40, list.count());
+    ASSERT_EQ(-20, list.front());
+    ASSERT_EQ(19, list.back());
+
+    int expected = -20;
+
+    for (int x : list) {
+        ASSERT_EQ(expected++, x);
+    }
+
+    for (int i = 19; i >= 0; --i) {
+        ASSERT_EQ(i, list.back());
+        list.pop_back();
+
+        ASSERT_EQ(-i - 1, list.front());
+        list.pop_front();
+    }
+
+    ASSERT_EQ(0, list.count());
+    ASSERT_TRUE(list.begin() == list.end());
+}
+
+TEST(UnrolledList, InsertErase) {
+    alg::ds::list::UnrolledList<int, 4> list;
+
+    for (int i = 0; i < 8; ++i) {
+        list.push_back(i * 10);
+    }
+
+    auto it = list.search(30);
+    ASSERT_EQ(30, *it);
+
+    it = list.insert(it, 25);
+    ASSERT_EQ(25, *it);
+    ASSERT_EQ(30, *std::next(it));
+    ASSERT_EQ(20, *std::prev(it));
+
+    it = list.erase(list.search(20));
+    ASSERT_EQ(25, *it);
+
+    ASSERT_TRUE(list.search(20) == list.end());
+    ASSERT_EQ(8, list.count());
+
+    it = list.insert(list.end(), 80);
+    ASSERT_EQ(80, *it);
+    ASSERT_EQ(80, list.back());
+
+    it = list.erase(it);
+    ASSERT_TRUE(it == list.end());
+    ASSERT_EQ(70, *--it);
+}
+
+TEST(UnrolledList, InsertOwnElement) {
+    alg::ds::list::UnrolledList<std::string, 4> list;
+    std::list<std::string> std_list;
+
+    for (char c = 'a'; c < 'g'; ++c) {
+        list.push_back(std::string(32, c));
+        std_list.push_back(std::string(32, c));
+    }
+
+    for (int i = 0; i < 6; ++i) {
+        list.push_front(list.front());
+        std_list.push_front(std_list.front());
+
+        auto it = std::next(list.begin(), 2 * i + 1);
+        auto std_it = std::next(std_list.begin(), 2 * i + 1);
+
+        list.insert(std::prev(it), *it);
+        std_list.insert(std::prev(std_it), *std_it);
+    }
+
+    ASSERT_EQ(std_list.size(), list.count());
+    ASSERT_TRUE(std::equal(std_list.begin(), std_list.end(), list.begin()));
+}
+
+TEST(UnrolledList, ConstIteration) {
+    alg::ds::list::UnrolledList<int, 4> list;
+
+    for (int i = 0; i < 10; ++i) {
+        list.push_back(i);
+    }
+
+    const alg::ds::list::UnrolledList<int, 4>& clist = list;
+    alg::ds::list::UnrolledList<int, 4>::const_iterator it = list.begin();
+
+    ASSERT_TRUE(it == clist.begin());
+    ASSERT_EQ(7, *clist.search(7));
+    ASSERT_TRUE(clist.search(10) == clist.end());
+
+    int expected = 9;
+
+    for (it = clist.end(); it != clist.begin(); ) {
+        ASSERT_EQ(expected--, *--it);
+    }
+
+    ASSERT_EQ(-1, expected);
+}
+
+TEST(UnrolledList, MoveOnly) {
+    alg::ds::list::UnrolledList<std::unique_ptr<int>, 4> list;
+
+    for (int i = 0; i < 10; ++i) {
+        list.push_back(std::unique_ptr<int>(new int(i)));
+    }
+
+    auto it = list.insert(std::next(list.begin(), 3),
+            std::unique_ptr<int>(new int(100)));
+    ASSERT_EQ(100, **it);
+
+    list.erase(list.begin());
+    ASSERT_EQ(1, *list.front());
+    ASSERT_EQ(10, list.count());
+}
+
+TEST(UnrolledList, Random) {
+    alg::ds::list::UnrolledList<std::string, 8> list;
+    std::list<std::string> model;
+
+    for (int step = 0; step < 5000; ++step) {
+        int op = alg::randomizer::uniform_int(0, 9);
+
+        if (op < 6 || model.empty()) {
+            int at = alg::randomizer::uniform_int(0, static_cast<int>(model.size()));
+            std::string value = std::to_string(step);
+
+            auto it = list.insert(std::next(list.begin(), at), value);
+            model.insert(std::next(model.begin(), at), value);
+
+            ASSERT_EQ(value, *it);
+        } else {
+            int at = alg::randomizer::uniform_int(0, static_cast<int>(model.size()) - 1);
+
+            auto it = list.erase(std::next(list.begin(), at));
+            auto expected = model.erase(std::next(model.begin(), at));
+
+            if (expected == model.end()) {
+                ASSERT_TRUE(it == list.end());
+            } else {
+                ASSERT_EQ(*expected, *it);
+            }
+        }
+
+        ASSERT_EQ(model.size(), list.count());
+    }
+
+    auto it = list.begin();
+
+    for (const std::string& x : model) {
+        ASSERT_EQ(x, *it++);
+    }
+
+    ASSERT_TRUE(it == list.end());
+
+    while (list.count()) {
+        ASSERT_EQ(model.back(), list.back());
+        list.pop_back();
+        model.pop_back();
+    }
+}
+
+}
@@ -0,0 +1,123 @@
+#include <cstddef>
+
+#include <atomic>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "alg/data_structure/work_stealing_deque.h"
+
+namespace algtest {
+
+TEST(WorkStealingDeque, OwnerAndThief) {
+    ASSERT_THROW(alg::ds::WorkStealingDeque<int>(0), std::invalid_argument);
+
+    alg::ds::WorkStealingDeque<int> deq(2);
+    int element;
+
+    ASSERT_EQ(2, deq.capacity());
+    ASSERT_FALSE(deq.pop(element));
+    ASSERT_FALSE(deq.steal(element));
+
+    for (int i = 0; i < 10; ++i) {
+        deq.push(i);
+    }
+
+    ASSERT_EQ(10, deq.count());
+    ASSERT_EQ(16, deq.capacity());
+
+    ASSERT_TRUE(deq.steal(element));
+    ASSERT_EQ(0, element);
+    ASSERT_TRUE(deq.steal(element));
+    ASSERT_EQ(1, element);
+
+    ASSERT_TRUE(deq.pop(element));
+    ASSERT_EQ(9, element);
+    ASSERT_TRUE(deq.pop(element));
+    ASSERT_EQ(8, element);
+
+    ASSERT_EQ(6, deq.count());
+
+    for (int i = 7; i >= 2; --i) {
+        ASSERT_TRUE(deq.pop(element));
+        ASSERT_EQ(i, element);
+    }
+
+    ASSERT_EQ(0, deq.count());
+    ASSERT_FALSE(deq.pop(element));
+    ASSERT_FALSE(deq.steal(element));
+
+    deq.push(42);
+
+    ASSERT_TRUE(deq.steal(element));
+    ASSERT_EQ(42, element);
+    ASSERT_FALSE(deq.pop(element));
+}
+
+TEST(WorkStealingDeque, Stress) {
+    constexpr int total = 200000;
+    constexpr int thieves = 3;
+
+    alg::ds::WorkStealingDeque<int> deq(4);
+    std::vector<std::atomic<int>> seen(total);
+    std::atomic<int> taken{0};
+    std::atomic<bool> done{false};
+
+    for (auto& s : seen) {
+        s.store(0);
+    }
+
+    std::vector<std::thread> threads;
+
+    for (int i = 0; i < thieves; ++i) {
+        threads.emplace_back([&] {
+            int element;
+
+            while (!done.load()) {
+                if (deq.steal(element)) {
+                    seen[element].fetch_add(1);
+                    taken.fetch_add(1);
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    int element;
+
+    for (int i = 0; i < total; ++i) {
+        deq.push(i);
+
+        if (i % 3 == 0 && deq.pop(element)) {
+            seen[element].fetch_add(1);
+            taken.fetch_add(1);
+        }
+    }
+
+    while (deq.pop(element)) {
+        seen[element].fetch_add(1);
+        taken.fetch_add(1);
+    }
+
+    while (taken.load() < total) {
+        std::this_thread::yield();
+    }
+
+    done.store(true);
+
+    for (std::thread& t : threads) {
+        t.join();
+    }
+
+    ASSERT_EQ(total, taken.load());
+    ASSERT_EQ(0, deq.count());
+
+    for (auto& s : seen) {
+        ASSERT_EQ(1, s.load());
+    }
+}
+
+}